@@ -51,6 +51,24 @@ json_source = sp.check_output(
 if rewrite_if_needed("src/ebmgen/json_conv.cpp", json_source.decode("utf-8")):
     something_changed = True
 
+# run tool/ebmcodegen --mode json-stream-header > src/ebmgen/json_stream_conv.hpp
+json_stream_header = sp.check_output(
+    ["tool/ebmcodegen", "--mode", "json-stream-header"], stderr=sys.stderr
+)
+if rewrite_if_needed(
+    "src/ebmgen/json_stream_conv.hpp", json_stream_header.decode("utf-8")
+):
+    something_changed = True
+
+# run tool/ebmcodegen --mode json-stream-source > src/ebmgen/json_stream_conv.cpp
+json_stream_source = sp.check_output(
+    ["tool/ebmcodegen", "--mode", "json-stream-source"], stderr=sys.stderr
+)
+if rewrite_if_needed(
+    "src/ebmgen/json_stream_conv.cpp", json_stream_source.decode("utf-8")
+):
+    something_changed = True
+
 ops = (
     sp.check_output(["python", "script/ebmop.py"], stderr=sys.stderr)
     .decode("utf-8")
@@ -736,6 +736,8 @@ namespace ebm::zc {
         BIT_FIELD_TO_BIT_SHIFT = 6,
         MULTI_REPRESENTATION = 7,
         VECTORIZED_IO = 8,
+        FIXED_LAYOUT_DECODE = 9,
+        BULK_PRIMITIVE_ARRAY = 10,
     };
     constexpr const char* to_string(LoweringIOType e, bool origin_form = false) {
         switch(e) {
@@ -748,6 +750,8 @@ namespace ebm::zc {
             case LoweringIOType::BIT_FIELD_TO_BIT_SHIFT: return origin_form ? "BIT_FIELD_TO_BIT_SHIFT":"BIT_FIELD_TO_BIT_SHIFT" ;
             case LoweringIOType::MULTI_REPRESENTATION: return origin_form ? "MULTI_REPRESENTATION":"MULTI_REPRESENTATION" ;
             case LoweringIOType::VECTORIZED_IO: return origin_form ? "VECTORIZED_IO":"VECTORIZED_IO" ;
+            case LoweringIOType::FIXED_LAYOUT_DECODE: return origin_form ? "FIXED_LAYOUT_DECODE":"FIXED_LAYOUT_DECODE" ;
+            case LoweringIOType::BULK_PRIMITIVE_ARRAY: return origin_form ? "BULK_PRIMITIVE_ARRAY":"BULK_PRIMITIVE_ARRAY" ;
         }
         return "";
     }
@@ -783,6 +787,12 @@ namespace ebm::zc {
         if (str == "VECTORIZED_IO") {
             return LoweringIOType::VECTORIZED_IO;
         }
+        if (str == "FIXED_LAYOUT_DECODE") {
+            return LoweringIOType::FIXED_LAYOUT_DECODE;
+        }
+        if (str == "BULK_PRIMITIVE_ARRAY") {
+            return LoweringIOType::BULK_PRIMITIVE_ARRAY;
+        }
         return std::nullopt;
     }
     constexpr const char* visit_enum(LoweringIOType) {
@@ -125,8 +125,11 @@ DEFINE_VISITOR(Statement_FUNCTION_DECL) {
     }
 
     // first, traverse body to detect bitfield pointer getters
-    ctx.config()
-        .ptr_to_optional = ctx.config().ptr_to_optional_targets.contains(get_id(ctx.item_id));
+    auto ptr_to_optional = ctx.config().ptr_to_optional_targets.contains(get_id(ctx.item_id));
+    if (ctx.config().ptr_to_optional != ptr_to_optional) {
+        ctx.config().ptr_to_optional = ptr_to_optional;
+        ctx.config().type_memoization_config.invalidate("ptr_to_optional");
+    }
 
     MAYBE(ret_type, ctx.visit(ctx.func_decl.return_type));
 
@@ -135,6 +135,22 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
         } \
     } while(0)
 
+    #define EBM_READ_PRIMITIVE_ARRAY(io, target, count, need_swap, offset_value,field_str) do { \
+        size_t size_ = (count) * sizeof((target)[0]); \
+        if (DECODER_CAN_READ((io), size_)) { \
+            if ((offset_value) == 0) { \
+                MEMCPY((target), (io)->data + (io)->offset, size_); \
+                if (need_swap) { \
+                    EBM_BYTE_SWAP_ELEMENTS((target), (count), sizeof((target)[0])); \
+                } \
+            }  \
+            (io)->offset += size_; \
+        } else { \
+            EBM_EMIT_ERROR(field_str ": Not enough data to read primitive array"); \
+            return -1; \
+        } \
+    } while(0)
+
     #ifndef EBM_GET_REMAINING_BYTES
     #define EBM_GET_REMAINING_BYTES(io) ((size_t)((io)->data_end - ((io)->data + (io)->offset)))
     #endif
@@ -173,6 +189,25 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
     #define MEMCPY(dest, src, size) __builtin_memcpy((dest), (src), (size))
     #endif
 
+    #ifndef EBM_HOST_BIG_ENDIAN
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define EBM_HOST_BIG_ENDIAN 1
+    #else
+    #define EBM_HOST_BIG_ENDIAN 0
+    #endif
+    #endif
+
+    #define EBM_BYTE_SWAP_ELEMENTS(ptr, count, elem_size) do { \
+        EBM_U8_TYPE* p_ = (EBM_U8_TYPE*)(ptr); \
+        for (size_t i_ = 0; i_ < (count); i_++, p_ += (elem_size)) { \
+            for (size_t j_ = 0; j_ < (elem_size) / 2; j_++) { \
+                EBM_U8_TYPE t_ = p_[j_]; \
+                p_[j_] = p_[(elem_size) - 1 - j_]; \
+                p_[(elem_size) - 1 - j_] = t_; \
+            } \
+        } \
+    } while(0)
+
     #define EBM_WRITE_BYTES(io, source, size_value, offset_value,field_str) do { \
         if((io)->emit) { \
             int res = (io)->emit((io), &(source), (size_value)); \
@@ -203,6 +238,20 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
         } \
     } while(0)
 
+    #define EBM_WRITE_PRIMITIVE_ARRAY(io, source, count, need_swap, offset_value,field_str) do { \
+        size_t size_ = (count) * sizeof((source)[0]); \
+        if ((size_t)((io)->data + (io)->offset + size_) <= (size_t)(io)->data_end) { \
+            MEMCPY((io)->data + (io)->offset, (source), size_); \
+            if (need_swap) { \
+                EBM_BYTE_SWAP_ELEMENTS((io)->data + (io)->offset, (count), sizeof((source)[0])); \
+            } \
+            (io)->offset += size_; \
+        } else { \
+            EBM_EMIT_ERROR(field_str ": Not enough space to write primitive array"); \
+            return -1; \
+        } \
+    } while(0)
+
     #define EBM_FREE_VECTOR(vector, elem_size) do { \
         if(input->free) \
         { \
@@ -233,6 +282,17 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
             }
         };
         CodeWriter w;
+        // with --stream-output text generated so far is written to root after prologue and after each function
+        // so that function bodies are not kept until whole program is generated; output is same as buffered one
+        const bool stream = ctx.flags().stream_output && ctx.config().allow_stream_output;
+        auto flush = [&] {
+            if (!stream) {
+                return;
+            }
+            auto line = ctx.visitor.wm.write_root(w);
+            convert_location_info(ctx, w, line);
+            w = CodeWriter{};
+        };
 
         std::vector<ebm::StatementRef> composite_fns;
         std::unordered_set<std::uint64_t> parents_set;
@@ -583,12 +643,14 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
             for (auto& composite_fn_ref : composite_fns) {
                 MAYBE(func, ctx.visit(composite_fn_ref));
                 w.writeln(func.to_writer());
+                flush();
             }
             // for each properties
             for (auto& s : c_ctx.structs) {
                 for (auto& prop_ref : s.properties) {
                     MAYBE(prop, ctx.visit(prop_ref));
                     w.writeln(prop.to_writer());
+                    flush();
                 }
             }
             // write encoding/decoding functions if any
@@ -596,11 +658,13 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
                 if (s.encode_function) {
                     MAYBE(func, ctx.visit(*s.encode_function));
                     w.writeln(func.to_writer());
+                    flush();
                     if (!ctx.flags().omit_destructor) {
                         ctx.config().on_destructor_generation = true;
                         ctx.config().encoder_input_type = "FreeFunctionInput*";
                         MAYBE(free_func, ctx.visit(*s.encode_function));
                         w.writeln(free_func.to_writer());
+                        flush();
                         ctx.config().on_destructor_generation = false;
                         ctx.config().encoder_input_type = "EncoderInput*";
                     }
@@ -608,12 +672,14 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
                 if (s.decode_function) {
                     MAYBE(func, ctx.visit(*s.decode_function));
                     w.writeln(func.to_writer());
+                    flush();
                 }
             }
             return {};
         };
         if (ctx.flags().output_mode != OutputMode::Source) {
             MAYBE_VOID(ok, header_prologue());
+            flush();
             ctx.config().forward_decl = true;
             MAYBE_VOID(fwd, foreach_function());
         }
@@ -624,6 +690,7 @@ DEFINE_VISITOR_CLASS(Statement_PROGRAM_DECL) {
             ctx.config().forward_decl = false;
             MAYBE_VOID(def, foreach_function());
         }
+        flush();
         return w;
     };
 
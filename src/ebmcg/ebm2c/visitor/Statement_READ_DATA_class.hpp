@@ -42,9 +42,30 @@
 #include "ebmcodegen/stub/util.hpp"
 DEFINE_VISITOR(Statement_READ_DATA) {
     using namespace CODEGEN_NAMESPACE;
-    if (auto low = ctx.read_data.lowered_statement()) {
-        if (low->lowering_type == ebm::LoweringIOType::VECTORIZED_IO) {
-            return ctx.visit(low->io_statement.id);
+    // lowering may be wrapped by MULTI_REPRESENTATION
+    if (auto vectorized = find_lowered_io(ctx, ctx.read_data, ebm::LoweringIOType::VECTORIZED_IO)) {
+        return ctx.visit(vectorized->io_statement.id);
+    }
+    // single bounds checked read instead of calling decode function of fixed layout struct
+    if (auto fixed = find_lowered_io(ctx, ctx.read_data, ebm::LoweringIOType::FIXED_LAYOUT_DECODE)) {
+        return ctx.visit(fixed->io_statement.id);
+    }
+    if (auto bulk = get_bulk_primitive_array(ctx, ctx.read_data)) {
+        auto need_swap = primitive_array_need_swap(bulk->io_data->attribute.endian());
+        auto type = ctx.visitor.module_.get_type(ctx.read_data.data_type);
+        // vector requires allocation, so only fixed array is read at once
+        if (need_swap && type && type->body.kind == ebm::TypeKind::ARRAY) {
+            MAYBE(target, ctx.visit(ctx.read_data.target));
+            MAYBE(length, get_element_count_default(ctx, ctx.read_data.data_type, ctx.read_data.size));
+            auto io_ = ctx.identifier(ctx.read_data.io_ref);
+            auto offset_val = CODE("0");
+            if (auto offset = ctx.read_data.offset()) {
+                MAYBE(offset_str, ctx.visit(*offset));
+                offset_val = offset_str.to_writer();
+            }
+            MAYBE(layer_str, get_identifier_layer_str(ctx, from_weak(ctx.read_data.field)));
+            layer_str = "\"" + layer_str + "\"";
+            return CODELINE("EBM_READ_PRIMITIVE_ARRAY(", io_, ", ", target.to_writer(), ", ", length, ", ", *need_swap, ", ", offset_val, ", ", layer_str, ");");
         }
     }
     if (auto cand = is_bytes_type(ctx, ctx.read_data.data_type)) {
@@ -68,7 +89,7 @@ DEFINE_VISITOR(Statement_READ_DATA) {
         return CODELINE("EBM_READ_ARRAY_BYTES(", io_, ", ", target.to_writer(), ", ", size_str, ", ", offset_val, ", ", layer_str, ");");
     }
     if (auto lw = ctx.read_data.lowered_statement()) {
-        if (lw->lowering_type == ebm::LoweringIOType::ARRAY_FOR_EACH && ctx.read_data.size.unit != ebm::SizeUnit::DYNAMIC) {
+        if (find_lowered_io(ctx, ctx.read_data, ebm::LoweringIOType::ARRAY_FOR_EACH) && ctx.read_data.size.unit != ebm::SizeUnit::DYNAMIC) {
             MAYBE(target, ctx.visit(ctx.read_data.target));
             if (auto length = get_element_count_default(ctx, ctx.read_data.data_type, ctx.read_data.size)) {
                 CodeWriter w;
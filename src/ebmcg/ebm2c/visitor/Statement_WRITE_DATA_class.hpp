@@ -41,9 +41,25 @@
 #include "ebm/extended_binary_module.hpp"
 DEFINE_VISITOR(Statement_WRITE_DATA) {
     using namespace CODEGEN_NAMESPACE;
-    if (auto low = ctx.write_data.lowered_statement()) {
-        if (low->lowering_type == ebm::LoweringIOType::VECTORIZED_IO) {
-            return ctx.visit(low->io_statement.id);
+    // lowering may be wrapped by MULTI_REPRESENTATION
+    if (auto vectorized = find_lowered_io(ctx, ctx.write_data, ebm::LoweringIOType::VECTORIZED_IO)) {
+        return ctx.visit(vectorized->io_statement.id);
+    }
+    if (auto bulk = get_bulk_primitive_array(ctx, ctx.write_data); bulk && !ctx.config().on_destructor_generation) {
+        auto need_swap = primitive_array_need_swap(bulk->io_data->attribute.endian());
+        auto type = ctx.visitor.module_.get_type(ctx.write_data.data_type);
+        if (need_swap && type && type->body.kind == ebm::TypeKind::ARRAY) {
+            MAYBE(target, ctx.visit(ctx.write_data.target));
+            MAYBE(length, get_element_count_default(ctx, ctx.write_data.data_type, ctx.write_data.size));
+            auto io_ = ctx.identifier(ctx.write_data.io_ref);
+            auto offset_val = CODE("0");
+            if (auto offset = ctx.write_data.offset()) {
+                MAYBE(offset_str, ctx.visit(*offset));
+                offset_val = offset_str.to_writer();
+            }
+            MAYBE(layer_str, get_identifier_layer_str(ctx, from_weak(ctx.write_data.field)));
+            layer_str = "\"" + layer_str + "\"";
+            return CODELINE("EBM_WRITE_PRIMITIVE_ARRAY(", io_, ", ", target.to_writer(), ", ", length, ", ", *need_swap, ", ", offset_val, ", ", layer_str, ");");
         }
     }
     if (auto cand = is_bytes_type(ctx, ctx.write_data.data_type)) {
@@ -73,10 +89,16 @@ DEFINE_VISITOR(Statement_WRITE_DATA) {
         return CODELINE("EBM_WRITE_ARRAY_BYTES(", io_, ", ", target.to_writer(), ", ", size_str, ", ", offset_val, ", ", layer_str, ");");
     }
     if (auto lw = ctx.write_data.lowered_statement()) {
-        if (ctx.config().on_destructor_generation &&
-            lw->lowering_type != ebm::LoweringIOType::STRUCT_CALL &&
-            lw->lowering_type != ebm::LoweringIOType::ARRAY_FOR_EACH) {
-            return CODELINE("// WRITE_DATA skipped in free function generation");
+        if (ctx.config().on_destructor_generation) {
+            // lowering may be wrapped by MULTI_REPRESENTATION
+            auto free_target = find_lowered_io(ctx, ctx.write_data, ebm::LoweringIOType::STRUCT_CALL);
+            if (!free_target) {
+                free_target = find_lowered_io(ctx, ctx.write_data, ebm::LoweringIOType::ARRAY_FOR_EACH);
+            }
+            if (!free_target) {
+                return CODELINE("// WRITE_DATA skipped in free function generation");
+            }
+            return ctx.visit(free_target->io_statement.id);
         }
         return ctx.visit(lw->io_statement.id);
     }
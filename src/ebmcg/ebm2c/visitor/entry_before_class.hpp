@@ -62,6 +62,19 @@ DEFINE_VISITOR(entry_before) {
         }
         return CODE("VECTOR_OF(", elem_type.to_writer(), ")");
     };
+    // element types are rendered differently inside ARRAY_OF/VECTOR_OF
+    ctx.config().type_memoization_config.enable = true;
+    ctx.config().type_memoization_config.target_kind_as_exclusive = true;
+    // encoder_input_type is switched while rendering destructors
+    ctx.config().type_memoization_config.target_kinds = {
+        ebm::TypeKind::ENCODER_INPUT,
+        ebm::TypeKind::DECODER_INPUT,
+        ebm::TypeKind::ENCODER_RETURN,
+        ebm::TypeKind::DECODER_RETURN,
+    };
+    ctx.config().type_memoization_config.context_key = [&config = ctx.config()]() -> std::uint64_t {
+        return config.inner_element_type ? 1 : 0;
+    };
     ctx.config().param_type_wrapper = [&](Context_Statement_PARAMETER_DECL& ctx, Result typ) -> expected<Result> {
         if (ctx.param_decl.is_state_variable()) {
             return CODE(typ.to_writer(), "*");  // In C, parameters are passed as pointers
@@ -95,6 +108,8 @@ DEFINE_VISITOR(entry_before) {
     ctx.config().enum_member_separator = ",";
     ctx.config().endof_enum_definition = ";";
     ctx.config().pointer_type_wrapper = [&](Result elem_type) -> expected<Result> {
+        // switched per function by Statement_FUNCTION_DECL, which invalidates memoized types using it
+        ctx.config().type_memoization_config.depends_on("ptr_to_optional");
         if (ctx.config().ptr_to_optional) {
             return CODE("OPTIONAL_OF(", elem_type.to_writer(), ")");
         }
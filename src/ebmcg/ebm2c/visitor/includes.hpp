@@ -96,6 +96,21 @@ namespace ebm2c {
         return false;
     }
 
+    // condition to byte swap elements of bulk primitive array on host
+    // dynamic endian is decided at runtime per stream, so not supported
+    inline std::optional<std::string_view> primitive_array_need_swap(ebm::Endian endian) {
+        switch (endian) {
+            case ebm::Endian::big:
+                return "!EBM_HOST_BIG_ENDIAN";
+            case ebm::Endian::little:
+                return "EBM_HOST_BIG_ENDIAN";
+            case ebm::Endian::native:
+                return "0";
+            default:
+                return std::nullopt;
+        }
+    }
+
     enum class OutputMode {
         Header,
         HeaderOnly,
@@ -78,8 +78,7 @@ DEFINE_VISITOR(Expression_MEMBER_ACCESS_before) {
     }
     MAYBE(member, ctx.get_field<"body.id">(ctx.member));
     if (auto type_ref = get_variant_member_from_field(ctx, from_weak(member))) {
-        auto got = ctx.config().bulk_primitive.find(get_id(*type_ref));
-        if (got != ctx.config().bulk_primitive.end()) {
+        if (ctx.config().bulk_primitive.contains(get_id(*type_ref))) {
             // self.x -> self.
             MAYBE(base, ctx.get_field<"body.base">(ctx.base));
             MAYBE(field, (ctx.get_field<physical_field>(*type_ref)));
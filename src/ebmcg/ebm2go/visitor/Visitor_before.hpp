@@ -9,10 +9,11 @@
 
 /*here to write the hook*/
 std::set<std::string_view> imports;
-std::unordered_set<std::uint64_t> bulk_primitive;
-std::unordered_set<std::uint64_t> any_variant;
+CrossTable bulk_primitive;
+CrossTable any_variant;
 std::unordered_map<std::uint64_t, std::uint64_t> any_cast_counter;
-std::unordered_set<std::uint64_t> bool_mapped_func;
+CrossTable bool_mapped_func;
+std::set<std::string_view> toplevel_imports;  // imports before current top-level declaration
 bool use_io_reader_writer = true;
 bool append_io = false;
 ebm::StatementRef current_io;
@@ -15,7 +15,11 @@
 */
 /*DO NOT EDIT ABOVE SECTION MANUALLY*/
 
+#include <algorithm>
+#include <array>
 #include <cctype>
+#include <charconv>
+#include <iterator>
 #include <string>
 #include "../codegen.hpp"
 #include "ebm/extended_binary_module.hpp"
@@ -41,6 +45,147 @@ namespace CODEGEN_NAMESPACE {
         return {};
     }
 
+    // every package generated code may import (see imports.insert); replayed imports refer to these
+    constexpr std::string_view known_imports[] = {"bytes", "encoding/binary", "errors", "fmt", "io", "math"};
+
+    // state left by a top-level declaration and read by following ones (see toplevel_state_hash)
+    // io state is whatever last struct wrapper or WRITE_DATA set, any_cast_counter numbers temporaries
+    // across declarations and tables are filled by the declaration that renders them first
+    inline auto io_strings(auto& config) {
+        return std::array{&config.encoder_input_type, &config.decoder_input_type, &config.encoder_return_type,
+                          &config.encode_fn_name, &config.decode_fn_name};
+    }
+
+    inline auto cross_tables(auto& config) {
+        return std::array{std::pair{std::string_view("bool_mapped_func"), &config.bool_mapped_func},
+                          std::pair{std::string_view("bulk_primitive"), &config.bulk_primitive},
+                          std::pair{std::string_view("any_variant"), &config.any_variant}};
+    }
+
+    // imports are only read by file header, so they are not hashed
+    inline std::uint64_t toplevel_state_hash(auto& config) {
+        std::uint64_t h = 0;
+        for (auto str : io_strings(config)) {
+            h = ebmgen::hash_mix(h, ebmgen::hash_string(*str));
+        }
+        h = ebmgen::hash_mix(h, config.use_io_reader_writer);
+        h = ebmgen::hash_mix(h, config.append_io);
+        h = ebmgen::hash_mix(h, config.has_byte_io);
+        h = ebmgen::hash_mix(h, get_id(config.current_io));
+        std::uint64_t counters = 0;
+        for (auto& [type, count] : config.any_cast_counter) {
+            counters += ebmgen::hash_mix(type, count);
+        }
+        h = ebmgen::hash_mix(h, counters);
+        for (auto& [_, table] : cross_tables(config)) {
+            h = ebmgen::hash_mix(h, table->hash);
+        }
+        return h;
+    }
+
+    inline void toplevel_item_begin(auto& config) {
+        for (auto& [_, table] : cross_tables(config)) {
+            table->inserted.clear();
+        }
+        config.toplevel_imports = config.imports;
+    }
+
+    // effect lines:
+    //   io <use_io_reader_writer> <append_io> <has_byte_io> <current_io>
+    //   followed by one line for each of io_strings
+    //   cast <type> <count> (whole any_cast_counter)
+    //   <table> <id> (inserted)
+    //   import <package> (added)
+    inline std::string toplevel_item_end(auto& config) {
+        std::string effect;
+        auto out = std::back_inserter(effect);
+        std::format_to(out, "io {} {} {} {}\n", int(config.use_io_reader_writer), int(config.append_io), int(config.has_byte_io), get_id(config.current_io));
+        for (auto str : io_strings(config)) {
+            std::format_to(out, "{}\n", *str);
+        }
+        for (auto& [type, count] : config.any_cast_counter) {
+            std::format_to(out, "cast {} {}\n", type, count);
+        }
+        for (auto& [name, table] : cross_tables(config)) {
+            for (auto id : table->inserted) {
+                std::format_to(out, "{} {}\n", name, id);
+            }
+        }
+        for (auto imp : config.imports) {
+            if (!config.toplevel_imports.contains(imp)) {
+                std::format_to(out, "import {}\n", imp);
+            }
+        }
+        return effect;
+    }
+
+    inline expected<void> toplevel_item_replay(auto& config, std::string_view effect) {
+        auto line = [&] {
+            auto pos = effect.find('\n');
+            auto l = effect.substr(0, pos);
+            effect = pos == effect.npos ? std::string_view{} : effect.substr(pos + 1);
+            return l;
+        };
+        auto number = [](std::string_view& str) -> expected<std::uint64_t> {
+            std::uint64_t out = 0;
+            auto res = std::from_chars(str.data(), str.data() + str.size(), out);
+            if (res.ec != std::errc{}) {
+                return unexpect_error("broken top-level effect: {}", str);
+            }
+            str = str.substr(res.ptr - str.data());
+            if (str.starts_with(' ')) {
+                str = str.substr(1);
+            }
+            return out;
+        };
+        config.any_cast_counter.clear();  // effect has whole counter
+        while (!effect.empty()) {
+            auto l = line();
+            auto tag = l.substr(0, l.find(' '));
+            auto rest = l.substr(std::min(l.size(), tag.size() + 1));
+            if (tag == "io") {
+                MAYBE(use_io_reader_writer, number(rest));
+                MAYBE(append_io, number(rest));
+                MAYBE(has_byte_io, number(rest));
+                MAYBE(current_io, number(rest));
+                config.use_io_reader_writer = use_io_reader_writer != 0;
+                config.append_io = append_io != 0;
+                config.has_byte_io = has_byte_io != 0;
+                MAYBE(io_id, varint(current_io));
+                config.current_io = ebm::StatementRef{io_id};
+                for (auto str : io_strings(config)) {
+                    *str = std::string(line());
+                }
+            }
+            else if (tag == "cast") {
+                MAYBE(type, number(rest));
+                MAYBE(count, number(rest));
+                config.any_cast_counter[type] = count;
+            }
+            else if (tag == "import") {
+                auto found = std::find(std::begin(known_imports), std::end(known_imports), rest);
+                if (found == std::end(known_imports)) {
+                    return unexpect_error("unknown import in top-level effect: {}", rest);
+                }
+                config.imports.insert(*found);
+            }
+            else {
+                bool found = false;
+                for (auto& [name, table] : cross_tables(config)) {
+                    if (name == tag) {
+                        MAYBE(id, number(rest));
+                        table->insert(id);
+                        found = true;
+                    }
+                }
+                if (!found) {
+                    return unexpect_error("broken top-level effect: {}", l);
+                }
+            }
+        }
+        return {};
+    }
+
 }  // namespace CODEGEN_NAMESPACE
 
 DEFINE_VISITOR(entry_before) {
@@ -48,6 +193,9 @@ DEFINE_VISITOR(entry_before) {
     ctx.config().io_mode.slice_io = !ctx.flags().no_slice_io;
     ctx.config().io_mode.std_io = !ctx.flags().no_std_io;
     ctx.config().io_mode.bytes_io = ctx.flags().bytes_io;
+    // package header and imports are written after all declarations are generated
+    ctx.config().allow_stream_output = false;
+    ctx.config().allow_parallel_toplevel = true;
     ctx.config().array_type_wrapper = [&](Context_Type_ARRAY& ctx) -> expected<Result> {
         MAYBE(elem_type, ctx.visit(ctx.element_type));
         if (!ctx.config().use_io_reader_writer && ctx.array_annotation != ebm::ArrayAnnotation::none) {
@@ -797,6 +945,9 @@ DEFINE_VISITOR(entry_before) {
         ebm::ExpressionKind::LITERAL_INT,
         ebm::ExpressionKind::LITERAL_INT64,
     };
+    ctx.config().expression_memoization_config.context_key = [&config = ctx.config()]() -> std::uint64_t {
+        return config.on_assign ? 1 : 0;
+    };
     ctx.config().type_memoization_config.enable = true;
     ctx.config().type_memoization_config.target_kind_as_exclusive = true;
     ctx.config().type_memoization_config.target_kinds = {
@@ -867,5 +1018,42 @@ DEFINE_VISITOR(entry_before) {
         }
         return pass;
     };
+    ctx.config().toplevel_state_hash = [&config = ctx.config()]() {
+        return toplevel_state_hash(config);
+    };
+    ctx.config().toplevel_item_begin = [&config = ctx.config()]() {
+        toplevel_item_begin(config);
+    };
+    ctx.config().toplevel_item_end = [&config = ctx.config()]() {
+        return toplevel_item_end(config);
+    };
+    ctx.config().toplevel_item_replay = [&config = ctx.config()](std::string_view effect) {
+        return toplevel_item_replay(config, effect);
+    };
+    ctx.config().toplevel_state_reset = [&config = ctx.config(),
+                                         encoder_input_type = ctx.config().encoder_input_type,
+                                         decoder_input_type = ctx.config().decoder_input_type,
+                                         encoder_return_type = ctx.config().encoder_return_type,
+                                         encode_fn_name = ctx.config().encode_fn_name,
+                                         decode_fn_name = ctx.config().decode_fn_name,
+                                         use_io_reader_writer = ctx.config().use_io_reader_writer,
+                                         append_io = ctx.config().append_io,
+                                         has_byte_io = ctx.config().has_byte_io,
+                                         current_io = ctx.config().current_io]() {
+        config.encoder_input_type = encoder_input_type;
+        config.decoder_input_type = decoder_input_type;
+        config.encoder_return_type = encoder_return_type;
+        config.encode_fn_name = encode_fn_name;
+        config.decode_fn_name = decode_fn_name;
+        config.use_io_reader_writer = use_io_reader_writer;
+        config.append_io = append_io;
+        config.has_byte_io = has_byte_io;
+        config.current_io = current_io;
+        config.any_cast_counter.clear();
+        for (auto& [_, table] : cross_tables(config)) {
+            table->clear();
+        }
+        config.imports.clear();
+    };
     return pass;
-}
+}
\ No newline at end of file
@@ -9,7 +9,11 @@
 
 /*here to write the hook*/
 #include "ebm/extended_binary_module.hpp"
+#include "ebmgen/fingerprint.hpp"
+#include <cstdint>
 #include <format>
+#include <unordered_set>
+#include <vector>
 namespace ebm2go {
     const ebm::FieldDecl* get_composite_field(auto&& ctx, auto target) {
         ebmgen::MappingTable& mapping = get_visitor(ctx).module_;
@@ -35,6 +39,31 @@ namespace ebm2go {
         const ebm::Type* length_type = nullptr;
     };
 
+    // ids filled lazily by the top-level declaration that renders them first and read by later ones
+    // inserts since toplevel_item_begin are kept for the declaration's effect (see toplevel_state_hash)
+    struct CrossTable {
+        std::unordered_set<std::uint64_t> ids;
+        std::vector<std::uint64_t> inserted;
+        std::uint64_t hash = 0;  // sum so that it does not depend on insertion order
+
+        bool contains(std::uint64_t id) const {
+            return ids.contains(id);
+        }
+
+        void insert(std::uint64_t id) {
+            if (ids.insert(id).second) {
+                inserted.push_back(id);
+                hash += ebmgen::hash_mix(0, id);
+            }
+        }
+
+        void clear() {
+            ids.clear();
+            inserted.clear();
+            hash = 0;
+        }
+    };
+
     struct IOMode {
         bool slice_io = false;
         bool std_io = false;
@@ -62845,6 +62845,7 @@ namespace ebm2rust {
     #if !defined(CODEGEN_EXPECTED_PRIORITY_TYPES_AFTER)
     #define CODEGEN_EXPECTED_PRIORITY_TYPES_AFTER 6
     #endif
+    constexpr const char* hook_source_names[] = {"UserHook", "UserInlinedHook", "UserDSLHook", "UserInlinedDSLHook", "DefaultCodegenVisitorHook", "DefaultCodegenVisitorInlinedHook", "GeneratorDefaultHook"};
     struct VisitorsImpl {
         Visitor<UserHook<VisitorTag_entry>> visitor_entry_UserHook;
         Visitor<UserInlinedHook<VisitorTag_entry>> visitor_entry_UserInlinedHook;
@@ -73544,1298 +73545,1622 @@ namespace ebm2rust {
     
         VisitorsImpl& impl;
         expected<Result> visit(Context_entry& ctx) {
+            CODEGEN_HOOK_PROFILE("entry", hook_source_names[CODEGEN_EXPECTED_PRIORITY_ENTRY]);
             auto visitor = impl.get_visitor_entry(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_entry_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("entry_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_ENTRY_BEFORE]);
             auto visitor = impl.get_visitor_entry_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_entry_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("entry_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_ENTRY_AFTER]);
             auto visitor = impl.get_visitor_entry_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_pre_visitor& ctx) {
+            CODEGEN_HOOK_PROFILE("pre_visitor", hook_source_names[CODEGEN_EXPECTED_PRIORITY_PRE_VISITOR]);
             auto visitor = impl.get_visitor_pre_visitor(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_pre_visitor_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("pre_visitor_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_PRE_VISITOR_BEFORE]);
             auto visitor = impl.get_visitor_pre_visitor_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_pre_visitor_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("pre_visitor_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_PRE_VISITOR_AFTER]);
             auto visitor = impl.get_visitor_pre_visitor_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_post_entry<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("post_entry", hook_source_names[CODEGEN_EXPECTED_PRIORITY_POST_ENTRY]);
             auto visitor = impl.get_visitor_post_entry(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_post_entry_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("post_entry_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_POST_ENTRY_BEFORE]);
             auto visitor = impl.get_visitor_post_entry_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_post_entry_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("post_entry_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_POST_ENTRY_AFTER]);
             auto visitor = impl.get_visitor_post_entry_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_BLOCK& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_BLOCK", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BLOCK]);
             auto visitor = impl.get_visitor_Statement_BLOCK(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_BLOCK_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_BLOCK_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BLOCK_BEFORE]);
             auto visitor = impl.get_visitor_Statement_BLOCK_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_BLOCK_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_BLOCK_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BLOCK_AFTER]);
             auto visitor = impl.get_visitor_Statement_BLOCK_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ASSIGNMENT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ASSIGNMENT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ASSIGNMENT]);
             auto visitor = impl.get_visitor_Statement_ASSIGNMENT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ASSIGNMENT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ASSIGNMENT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ASSIGNMENT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ASSIGNMENT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ASSIGNMENT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ASSIGNMENT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ASSIGNMENT_AFTER]);
             auto visitor = impl.get_visitor_Statement_ASSIGNMENT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_YIELD& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_YIELD", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_YIELD]);
             auto visitor = impl.get_visitor_Statement_YIELD(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_YIELD_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_YIELD_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_YIELD_BEFORE]);
             auto visitor = impl.get_visitor_Statement_YIELD_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_YIELD_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_YIELD_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_YIELD_AFTER]);
             auto visitor = impl.get_visitor_Statement_YIELD_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_APPEND& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_APPEND", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_APPEND]);
             auto visitor = impl.get_visitor_Statement_APPEND(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_APPEND_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_APPEND_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_APPEND_BEFORE]);
             auto visitor = impl.get_visitor_Statement_APPEND_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_APPEND_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_APPEND_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_APPEND_AFTER]);
             auto visitor = impl.get_visitor_Statement_APPEND_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_RETURN& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_RETURN", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_RETURN]);
             auto visitor = impl.get_visitor_Statement_RETURN(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_RETURN_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_RETURN_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_RETURN_BEFORE]);
             auto visitor = impl.get_visitor_Statement_RETURN_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_RETURN_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_RETURN_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_RETURN_AFTER]);
             auto visitor = impl.get_visitor_Statement_RETURN_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ERROR_RETURN& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ERROR_RETURN", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ERROR_RETURN]);
             auto visitor = impl.get_visitor_Statement_ERROR_RETURN(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ERROR_RETURN_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ERROR_RETURN_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ERROR_RETURN_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ERROR_RETURN_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ERROR_RETURN_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ERROR_RETURN_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ERROR_RETURN_AFTER]);
             auto visitor = impl.get_visitor_Statement_ERROR_RETURN_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ASSERT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ASSERT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ASSERT]);
             auto visitor = impl.get_visitor_Statement_ASSERT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ASSERT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ASSERT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ASSERT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ASSERT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ASSERT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ASSERT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ASSERT_AFTER]);
             auto visitor = impl.get_visitor_Statement_ASSERT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_READ_DATA& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_READ_DATA", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_READ_DATA]);
             auto visitor = impl.get_visitor_Statement_READ_DATA(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_READ_DATA_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_READ_DATA_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_READ_DATA_BEFORE]);
             auto visitor = impl.get_visitor_Statement_READ_DATA_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_READ_DATA_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_READ_DATA_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_READ_DATA_AFTER]);
             auto visitor = impl.get_visitor_Statement_READ_DATA_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_WRITE_DATA& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_WRITE_DATA", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_WRITE_DATA]);
             auto visitor = impl.get_visitor_Statement_WRITE_DATA(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_WRITE_DATA_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_WRITE_DATA_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_WRITE_DATA_BEFORE]);
             auto visitor = impl.get_visitor_Statement_WRITE_DATA_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_WRITE_DATA_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_WRITE_DATA_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_WRITE_DATA_AFTER]);
             auto visitor = impl.get_visitor_Statement_WRITE_DATA_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_RESERVE_DATA& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_RESERVE_DATA", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_RESERVE_DATA]);
             auto visitor = impl.get_visitor_Statement_RESERVE_DATA(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_RESERVE_DATA_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_RESERVE_DATA_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_RESERVE_DATA_BEFORE]);
             auto visitor = impl.get_visitor_Statement_RESERVE_DATA_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_RESERVE_DATA_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_RESERVE_DATA_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_RESERVE_DATA_AFTER]);
             auto visitor = impl.get_visitor_Statement_RESERVE_DATA_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_IF_STATEMENT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_IF_STATEMENT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_IF_STATEMENT]);
             auto visitor = impl.get_visitor_Statement_IF_STATEMENT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_IF_STATEMENT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_IF_STATEMENT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_IF_STATEMENT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_IF_STATEMENT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_IF_STATEMENT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_IF_STATEMENT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_IF_STATEMENT_AFTER]);
             auto visitor = impl.get_visitor_Statement_IF_STATEMENT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LOOP_STATEMENT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LOOP_STATEMENT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LOOP_STATEMENT]);
             auto visitor = impl.get_visitor_Statement_LOOP_STATEMENT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LOOP_STATEMENT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LOOP_STATEMENT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LOOP_STATEMENT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_LOOP_STATEMENT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LOOP_STATEMENT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LOOP_STATEMENT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LOOP_STATEMENT_AFTER]);
             auto visitor = impl.get_visitor_Statement_LOOP_STATEMENT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_MATCH_STATEMENT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_MATCH_STATEMENT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_MATCH_STATEMENT]);
             auto visitor = impl.get_visitor_Statement_MATCH_STATEMENT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_MATCH_STATEMENT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_MATCH_STATEMENT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_MATCH_STATEMENT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_MATCH_STATEMENT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_MATCH_STATEMENT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_MATCH_STATEMENT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_MATCH_STATEMENT_AFTER]);
             auto visitor = impl.get_visitor_Statement_MATCH_STATEMENT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_MATCH_BRANCH& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_MATCH_BRANCH", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_MATCH_BRANCH]);
             auto visitor = impl.get_visitor_Statement_MATCH_BRANCH(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_MATCH_BRANCH_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_MATCH_BRANCH_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_MATCH_BRANCH_BEFORE]);
             auto visitor = impl.get_visitor_Statement_MATCH_BRANCH_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_MATCH_BRANCH_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_MATCH_BRANCH_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_MATCH_BRANCH_AFTER]);
             auto visitor = impl.get_visitor_Statement_MATCH_BRANCH_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_BREAK& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_BREAK", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BREAK]);
             auto visitor = impl.get_visitor_Statement_BREAK(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_BREAK_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_BREAK_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BREAK_BEFORE]);
             auto visitor = impl.get_visitor_Statement_BREAK_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_BREAK_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_BREAK_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BREAK_AFTER]);
             auto visitor = impl.get_visitor_Statement_BREAK_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_CONTINUE& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_CONTINUE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_CONTINUE]);
             auto visitor = impl.get_visitor_Statement_CONTINUE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_CONTINUE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_CONTINUE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_CONTINUE_BEFORE]);
             auto visitor = impl.get_visitor_Statement_CONTINUE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_CONTINUE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_CONTINUE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_CONTINUE_AFTER]);
             auto visitor = impl.get_visitor_Statement_CONTINUE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_FUNCTION_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_FUNCTION_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_FUNCTION_DECL]);
             auto visitor = impl.get_visitor_Statement_FUNCTION_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_FUNCTION_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_FUNCTION_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_FUNCTION_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_FUNCTION_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_FUNCTION_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_FUNCTION_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_FUNCTION_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_FUNCTION_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_VARIABLE_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_VARIABLE_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_VARIABLE_DECL]);
             auto visitor = impl.get_visitor_Statement_VARIABLE_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_VARIABLE_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_VARIABLE_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_VARIABLE_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_VARIABLE_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_VARIABLE_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_VARIABLE_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_VARIABLE_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_VARIABLE_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PARAMETER_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PARAMETER_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PARAMETER_DECL]);
             auto visitor = impl.get_visitor_Statement_PARAMETER_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PARAMETER_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PARAMETER_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PARAMETER_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_PARAMETER_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PARAMETER_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PARAMETER_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PARAMETER_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_PARAMETER_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_FIELD_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_FIELD_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_FIELD_DECL]);
             auto visitor = impl.get_visitor_Statement_FIELD_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_FIELD_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_FIELD_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_FIELD_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_FIELD_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_FIELD_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_FIELD_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_FIELD_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_FIELD_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_COMPOSITE_FIELD_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_COMPOSITE_FIELD_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_COMPOSITE_FIELD_DECL]);
             auto visitor = impl.get_visitor_Statement_COMPOSITE_FIELD_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_COMPOSITE_FIELD_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_COMPOSITE_FIELD_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_COMPOSITE_FIELD_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_COMPOSITE_FIELD_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_COMPOSITE_FIELD_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_COMPOSITE_FIELD_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_COMPOSITE_FIELD_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_COMPOSITE_FIELD_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENUM_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENUM_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENUM_DECL]);
             auto visitor = impl.get_visitor_Statement_ENUM_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENUM_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENUM_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENUM_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ENUM_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENUM_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENUM_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENUM_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_ENUM_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENUM_MEMBER_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENUM_MEMBER_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENUM_MEMBER_DECL]);
             auto visitor = impl.get_visitor_Statement_ENUM_MEMBER_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENUM_MEMBER_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENUM_MEMBER_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENUM_MEMBER_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ENUM_MEMBER_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENUM_MEMBER_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENUM_MEMBER_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENUM_MEMBER_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_ENUM_MEMBER_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_STRUCT_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_STRUCT_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_STRUCT_DECL]);
             auto visitor = impl.get_visitor_Statement_STRUCT_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_STRUCT_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_STRUCT_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_STRUCT_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_STRUCT_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_STRUCT_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_STRUCT_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_STRUCT_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_STRUCT_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_UNION_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_UNION_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_UNION_DECL]);
             auto visitor = impl.get_visitor_Statement_UNION_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_UNION_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_UNION_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_UNION_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_UNION_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_UNION_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_UNION_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_UNION_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_UNION_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_UNION_MEMBER_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_UNION_MEMBER_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_UNION_MEMBER_DECL]);
             auto visitor = impl.get_visitor_Statement_UNION_MEMBER_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_UNION_MEMBER_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_UNION_MEMBER_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_UNION_MEMBER_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_UNION_MEMBER_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_UNION_MEMBER_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_UNION_MEMBER_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_UNION_MEMBER_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_UNION_MEMBER_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROGRAM_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROGRAM_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROGRAM_DECL]);
             auto visitor = impl.get_visitor_Statement_PROGRAM_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROGRAM_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROGRAM_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROGRAM_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_PROGRAM_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROGRAM_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROGRAM_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROGRAM_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_PROGRAM_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROPERTY_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROPERTY_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROPERTY_DECL]);
             auto visitor = impl.get_visitor_Statement_PROPERTY_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROPERTY_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROPERTY_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROPERTY_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_PROPERTY_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROPERTY_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROPERTY_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROPERTY_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_PROPERTY_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROPERTY_MEMBER_DECL& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROPERTY_MEMBER_DECL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROPERTY_MEMBER_DECL]);
             auto visitor = impl.get_visitor_Statement_PROPERTY_MEMBER_DECL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROPERTY_MEMBER_DECL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROPERTY_MEMBER_DECL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROPERTY_MEMBER_DECL_BEFORE]);
             auto visitor = impl.get_visitor_Statement_PROPERTY_MEMBER_DECL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_PROPERTY_MEMBER_DECL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_PROPERTY_MEMBER_DECL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_PROPERTY_MEMBER_DECL_AFTER]);
             auto visitor = impl.get_visitor_Statement_PROPERTY_MEMBER_DECL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_METADATA& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_METADATA", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_METADATA]);
             auto visitor = impl.get_visitor_Statement_METADATA(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_METADATA_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_METADATA_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_METADATA_BEFORE]);
             auto visitor = impl.get_visitor_Statement_METADATA_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_METADATA_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_METADATA_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_METADATA_AFTER]);
             auto visitor = impl.get_visitor_Statement_METADATA_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_IMPORT_MODULE& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_IMPORT_MODULE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_IMPORT_MODULE]);
             auto visitor = impl.get_visitor_Statement_IMPORT_MODULE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_IMPORT_MODULE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_IMPORT_MODULE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_IMPORT_MODULE_BEFORE]);
             auto visitor = impl.get_visitor_Statement_IMPORT_MODULE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_IMPORT_MODULE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_IMPORT_MODULE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_IMPORT_MODULE_AFTER]);
             auto visitor = impl.get_visitor_Statement_IMPORT_MODULE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_EXPRESSION& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_EXPRESSION", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_EXPRESSION]);
             auto visitor = impl.get_visitor_Statement_EXPRESSION(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_EXPRESSION_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_EXPRESSION_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_EXPRESSION_BEFORE]);
             auto visitor = impl.get_visitor_Statement_EXPRESSION_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_EXPRESSION_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_EXPRESSION_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_EXPRESSION_AFTER]);
             auto visitor = impl.get_visitor_Statement_EXPRESSION_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ERROR_REPORT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ERROR_REPORT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ERROR_REPORT]);
             auto visitor = impl.get_visitor_Statement_ERROR_REPORT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ERROR_REPORT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ERROR_REPORT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ERROR_REPORT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ERROR_REPORT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ERROR_REPORT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ERROR_REPORT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ERROR_REPORT_AFTER]);
             auto visitor = impl.get_visitor_Statement_ERROR_REPORT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LOWERED_IO_STATEMENTS& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LOWERED_IO_STATEMENTS", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LOWERED_IO_STATEMENTS]);
             auto visitor = impl.get_visitor_Statement_LOWERED_IO_STATEMENTS(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LOWERED_IO_STATEMENTS_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LOWERED_IO_STATEMENTS_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LOWERED_IO_STATEMENTS_BEFORE]);
             auto visitor = impl.get_visitor_Statement_LOWERED_IO_STATEMENTS_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LOWERED_IO_STATEMENTS_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LOWERED_IO_STATEMENTS_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LOWERED_IO_STATEMENTS_AFTER]);
             auto visitor = impl.get_visitor_Statement_LOWERED_IO_STATEMENTS_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_SUB_BYTE_RANGE& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_SUB_BYTE_RANGE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_SUB_BYTE_RANGE]);
             auto visitor = impl.get_visitor_Statement_SUB_BYTE_RANGE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_SUB_BYTE_RANGE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_SUB_BYTE_RANGE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_SUB_BYTE_RANGE_BEFORE]);
             auto visitor = impl.get_visitor_Statement_SUB_BYTE_RANGE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_SUB_BYTE_RANGE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_SUB_BYTE_RANGE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_SUB_BYTE_RANGE_AFTER]);
             auto visitor = impl.get_visitor_Statement_SUB_BYTE_RANGE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_INIT_CHECK& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_INIT_CHECK", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_INIT_CHECK]);
             auto visitor = impl.get_visitor_Statement_INIT_CHECK(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_INIT_CHECK_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_INIT_CHECK_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_INIT_CHECK_BEFORE]);
             auto visitor = impl.get_visitor_Statement_INIT_CHECK_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_INIT_CHECK_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_INIT_CHECK_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_INIT_CHECK_AFTER]);
             auto visitor = impl.get_visitor_Statement_INIT_CHECK_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENDIAN_VARIABLE& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENDIAN_VARIABLE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENDIAN_VARIABLE]);
             auto visitor = impl.get_visitor_Statement_ENDIAN_VARIABLE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENDIAN_VARIABLE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENDIAN_VARIABLE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENDIAN_VARIABLE_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ENDIAN_VARIABLE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ENDIAN_VARIABLE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ENDIAN_VARIABLE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ENDIAN_VARIABLE_AFTER]);
             auto visitor = impl.get_visitor_Statement_ENDIAN_VARIABLE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ARRAY_TO_INT& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ARRAY_TO_INT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ARRAY_TO_INT]);
             auto visitor = impl.get_visitor_Statement_ARRAY_TO_INT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ARRAY_TO_INT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ARRAY_TO_INT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ARRAY_TO_INT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_ARRAY_TO_INT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_ARRAY_TO_INT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_ARRAY_TO_INT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_ARRAY_TO_INT_AFTER]);
             auto visitor = impl.get_visitor_Statement_ARRAY_TO_INT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_INT_TO_ARRAY& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_INT_TO_ARRAY", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_INT_TO_ARRAY]);
             auto visitor = impl.get_visitor_Statement_INT_TO_ARRAY(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_INT_TO_ARRAY_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_INT_TO_ARRAY_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_INT_TO_ARRAY_BEFORE]);
             auto visitor = impl.get_visitor_Statement_INT_TO_ARRAY_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_INT_TO_ARRAY_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_INT_TO_ARRAY_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_INT_TO_ARRAY_AFTER]);
             auto visitor = impl.get_visitor_Statement_INT_TO_ARRAY_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LENGTH_CHECK& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LENGTH_CHECK", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LENGTH_CHECK]);
             auto visitor = impl.get_visitor_Statement_LENGTH_CHECK(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LENGTH_CHECK_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LENGTH_CHECK_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LENGTH_CHECK_BEFORE]);
             auto visitor = impl.get_visitor_Statement_LENGTH_CHECK_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_LENGTH_CHECK_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_LENGTH_CHECK_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_LENGTH_CHECK_AFTER]);
             auto visitor = impl.get_visitor_Statement_LENGTH_CHECK_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT]);
             auto visitor = impl.get_visitor_Statement(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_BEFORE]);
             auto visitor = impl.get_visitor_Statement_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Statement_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Statement_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_STATEMENT_AFTER]);
             auto visitor = impl.get_visitor_Statement_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Block& ctx) {
+            CODEGEN_HOOK_PROFILE("Block", hook_source_names[CODEGEN_EXPECTED_PRIORITY_BLOCK]);
             auto visitor = impl.get_visitor_Block(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Block_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Block_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_BLOCK_BEFORE]);
             auto visitor = impl.get_visitor_Block_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Block_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Block_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_BLOCK_AFTER]);
             auto visitor = impl.get_visitor_Block_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_INT& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_INT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_INT]);
             auto visitor = impl.get_visitor_Expression_LITERAL_INT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_INT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_INT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_INT_BEFORE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_INT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_INT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_INT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_INT_AFTER]);
             auto visitor = impl.get_visitor_Expression_LITERAL_INT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_INT64& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_INT64", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_INT64]);
             auto visitor = impl.get_visitor_Expression_LITERAL_INT64(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_INT64_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_INT64_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_INT64_BEFORE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_INT64_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_INT64_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_INT64_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_INT64_AFTER]);
             auto visitor = impl.get_visitor_Expression_LITERAL_INT64_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_BOOL& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_BOOL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_BOOL]);
             auto visitor = impl.get_visitor_Expression_LITERAL_BOOL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_BOOL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_BOOL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_BOOL_BEFORE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_BOOL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_BOOL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_BOOL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_BOOL_AFTER]);
             auto visitor = impl.get_visitor_Expression_LITERAL_BOOL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_STRING& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_STRING", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_STRING]);
             auto visitor = impl.get_visitor_Expression_LITERAL_STRING(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_STRING_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_STRING_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_STRING_BEFORE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_STRING_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_STRING_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_STRING_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_STRING_AFTER]);
             auto visitor = impl.get_visitor_Expression_LITERAL_STRING_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_TYPE& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_TYPE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_TYPE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_TYPE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_TYPE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_TYPE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_TYPE_BEFORE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_TYPE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_TYPE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_TYPE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_TYPE_AFTER]);
             auto visitor = impl.get_visitor_Expression_LITERAL_TYPE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_CHAR& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_CHAR", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_CHAR]);
             auto visitor = impl.get_visitor_Expression_LITERAL_CHAR(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_CHAR_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_CHAR_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_CHAR_BEFORE]);
             auto visitor = impl.get_visitor_Expression_LITERAL_CHAR_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_LITERAL_CHAR_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_LITERAL_CHAR_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_LITERAL_CHAR_AFTER]);
             auto visitor = impl.get_visitor_Expression_LITERAL_CHAR_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IDENTIFIER& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IDENTIFIER", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IDENTIFIER]);
             auto visitor = impl.get_visitor_Expression_IDENTIFIER(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IDENTIFIER_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IDENTIFIER_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IDENTIFIER_BEFORE]);
             auto visitor = impl.get_visitor_Expression_IDENTIFIER_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IDENTIFIER_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IDENTIFIER_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IDENTIFIER_AFTER]);
             auto visitor = impl.get_visitor_Expression_IDENTIFIER_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_BINARY_OP& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_BINARY_OP", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_BINARY_OP]);
             auto visitor = impl.get_visitor_Expression_BINARY_OP(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_BINARY_OP_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_BINARY_OP_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_BINARY_OP_BEFORE]);
             auto visitor = impl.get_visitor_Expression_BINARY_OP_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_BINARY_OP_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_BINARY_OP_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_BINARY_OP_AFTER]);
             auto visitor = impl.get_visitor_Expression_BINARY_OP_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_UNARY_OP& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_UNARY_OP", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_UNARY_OP]);
             auto visitor = impl.get_visitor_Expression_UNARY_OP(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_UNARY_OP_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_UNARY_OP_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_UNARY_OP_BEFORE]);
             auto visitor = impl.get_visitor_Expression_UNARY_OP_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_UNARY_OP_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_UNARY_OP_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_UNARY_OP_AFTER]);
             auto visitor = impl.get_visitor_Expression_UNARY_OP_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CALL& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CALL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CALL]);
             auto visitor = impl.get_visitor_Expression_CALL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CALL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CALL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CALL_BEFORE]);
             auto visitor = impl.get_visitor_Expression_CALL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CALL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CALL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CALL_AFTER]);
             auto visitor = impl.get_visitor_Expression_CALL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_INDEX_ACCESS& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_INDEX_ACCESS", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_INDEX_ACCESS]);
             auto visitor = impl.get_visitor_Expression_INDEX_ACCESS(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_INDEX_ACCESS_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_INDEX_ACCESS_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_INDEX_ACCESS_BEFORE]);
             auto visitor = impl.get_visitor_Expression_INDEX_ACCESS_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_INDEX_ACCESS_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_INDEX_ACCESS_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_INDEX_ACCESS_AFTER]);
             auto visitor = impl.get_visitor_Expression_INDEX_ACCESS_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_MEMBER_ACCESS& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_MEMBER_ACCESS", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_MEMBER_ACCESS]);
             auto visitor = impl.get_visitor_Expression_MEMBER_ACCESS(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_MEMBER_ACCESS_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_MEMBER_ACCESS_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_MEMBER_ACCESS_BEFORE]);
             auto visitor = impl.get_visitor_Expression_MEMBER_ACCESS_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_MEMBER_ACCESS_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_MEMBER_ACCESS_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_MEMBER_ACCESS_AFTER]);
             auto visitor = impl.get_visitor_Expression_MEMBER_ACCESS_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ENUM_MEMBER& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ENUM_MEMBER", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ENUM_MEMBER]);
             auto visitor = impl.get_visitor_Expression_ENUM_MEMBER(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ENUM_MEMBER_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ENUM_MEMBER_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ENUM_MEMBER_BEFORE]);
             auto visitor = impl.get_visitor_Expression_ENUM_MEMBER_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ENUM_MEMBER_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ENUM_MEMBER_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ENUM_MEMBER_AFTER]);
             auto visitor = impl.get_visitor_Expression_ENUM_MEMBER_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_TYPE_CAST& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_TYPE_CAST", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_TYPE_CAST]);
             auto visitor = impl.get_visitor_Expression_TYPE_CAST(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_TYPE_CAST_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_TYPE_CAST_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_TYPE_CAST_BEFORE]);
             auto visitor = impl.get_visitor_Expression_TYPE_CAST_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_TYPE_CAST_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_TYPE_CAST_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_TYPE_CAST_AFTER]);
             auto visitor = impl.get_visitor_Expression_TYPE_CAST_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_RANGE& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_RANGE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_RANGE]);
             auto visitor = impl.get_visitor_Expression_RANGE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_RANGE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_RANGE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_RANGE_BEFORE]);
             auto visitor = impl.get_visitor_Expression_RANGE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_RANGE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_RANGE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_RANGE_AFTER]);
             auto visitor = impl.get_visitor_Expression_RANGE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_DEFAULT_VALUE& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_DEFAULT_VALUE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_DEFAULT_VALUE]);
             auto visitor = impl.get_visitor_Expression_DEFAULT_VALUE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_DEFAULT_VALUE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_DEFAULT_VALUE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_DEFAULT_VALUE_BEFORE]);
             auto visitor = impl.get_visitor_Expression_DEFAULT_VALUE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_DEFAULT_VALUE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_DEFAULT_VALUE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_DEFAULT_VALUE_AFTER]);
             auto visitor = impl.get_visitor_Expression_DEFAULT_VALUE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IS_LITTLE_ENDIAN& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IS_LITTLE_ENDIAN", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IS_LITTLE_ENDIAN]);
             auto visitor = impl.get_visitor_Expression_IS_LITTLE_ENDIAN(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IS_LITTLE_ENDIAN_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IS_LITTLE_ENDIAN_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IS_LITTLE_ENDIAN_BEFORE]);
             auto visitor = impl.get_visitor_Expression_IS_LITTLE_ENDIAN_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IS_LITTLE_ENDIAN_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IS_LITTLE_ENDIAN_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IS_LITTLE_ENDIAN_AFTER]);
             auto visitor = impl.get_visitor_Expression_IS_LITTLE_ENDIAN_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_GET_STREAM_OFFSET& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_GET_STREAM_OFFSET", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_GET_STREAM_OFFSET]);
             auto visitor = impl.get_visitor_Expression_GET_STREAM_OFFSET(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_GET_STREAM_OFFSET_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_GET_STREAM_OFFSET_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_GET_STREAM_OFFSET_BEFORE]);
             auto visitor = impl.get_visitor_Expression_GET_STREAM_OFFSET_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_GET_STREAM_OFFSET_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_GET_STREAM_OFFSET_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_GET_STREAM_OFFSET_AFTER]);
             auto visitor = impl.get_visitor_Expression_GET_STREAM_OFFSET_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_GET_REMAINING_BYTES& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_GET_REMAINING_BYTES", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_GET_REMAINING_BYTES]);
             auto visitor = impl.get_visitor_Expression_GET_REMAINING_BYTES(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_GET_REMAINING_BYTES_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_GET_REMAINING_BYTES_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_GET_REMAINING_BYTES_BEFORE]);
             auto visitor = impl.get_visitor_Expression_GET_REMAINING_BYTES_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_GET_REMAINING_BYTES_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_GET_REMAINING_BYTES_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_GET_REMAINING_BYTES_AFTER]);
             auto visitor = impl.get_visitor_Expression_GET_REMAINING_BYTES_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CAN_READ_STREAM& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CAN_READ_STREAM", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CAN_READ_STREAM]);
             auto visitor = impl.get_visitor_Expression_CAN_READ_STREAM(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CAN_READ_STREAM_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CAN_READ_STREAM_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CAN_READ_STREAM_BEFORE]);
             auto visitor = impl.get_visitor_Expression_CAN_READ_STREAM_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CAN_READ_STREAM_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CAN_READ_STREAM_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CAN_READ_STREAM_AFTER]);
             auto visitor = impl.get_visitor_Expression_CAN_READ_STREAM_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ARRAY_SIZE& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ARRAY_SIZE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ARRAY_SIZE]);
             auto visitor = impl.get_visitor_Expression_ARRAY_SIZE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ARRAY_SIZE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ARRAY_SIZE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ARRAY_SIZE_BEFORE]);
             auto visitor = impl.get_visitor_Expression_ARRAY_SIZE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ARRAY_SIZE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ARRAY_SIZE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ARRAY_SIZE_AFTER]);
             auto visitor = impl.get_visitor_Expression_ARRAY_SIZE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ENUM_IS_DEFINED& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ENUM_IS_DEFINED", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ENUM_IS_DEFINED]);
             auto visitor = impl.get_visitor_Expression_ENUM_IS_DEFINED(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ENUM_IS_DEFINED_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ENUM_IS_DEFINED_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ENUM_IS_DEFINED_BEFORE]);
             auto visitor = impl.get_visitor_Expression_ENUM_IS_DEFINED_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ENUM_IS_DEFINED_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ENUM_IS_DEFINED_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ENUM_IS_DEFINED_AFTER]);
             auto visitor = impl.get_visitor_Expression_ENUM_IS_DEFINED_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IS_ERROR& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IS_ERROR", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IS_ERROR]);
             auto visitor = impl.get_visitor_Expression_IS_ERROR(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IS_ERROR_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IS_ERROR_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IS_ERROR_BEFORE]);
             auto visitor = impl.get_visitor_Expression_IS_ERROR_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_IS_ERROR_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_IS_ERROR_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_IS_ERROR_AFTER]);
             auto visitor = impl.get_visitor_Expression_IS_ERROR_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_MAX_VALUE& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_MAX_VALUE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_MAX_VALUE]);
             auto visitor = impl.get_visitor_Expression_MAX_VALUE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_MAX_VALUE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_MAX_VALUE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_MAX_VALUE_BEFORE]);
             auto visitor = impl.get_visitor_Expression_MAX_VALUE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_MAX_VALUE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_MAX_VALUE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_MAX_VALUE_AFTER]);
             auto visitor = impl.get_visitor_Expression_MAX_VALUE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_READ_DATA& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_READ_DATA", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_READ_DATA]);
             auto visitor = impl.get_visitor_Expression_READ_DATA(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_READ_DATA_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_READ_DATA_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_READ_DATA_BEFORE]);
             auto visitor = impl.get_visitor_Expression_READ_DATA_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_READ_DATA_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_READ_DATA_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_READ_DATA_AFTER]);
             auto visitor = impl.get_visitor_Expression_READ_DATA_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_WRITE_DATA& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_WRITE_DATA", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_WRITE_DATA]);
             auto visitor = impl.get_visitor_Expression_WRITE_DATA(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_WRITE_DATA_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_WRITE_DATA_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_WRITE_DATA_BEFORE]);
             auto visitor = impl.get_visitor_Expression_WRITE_DATA_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_WRITE_DATA_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_WRITE_DATA_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_WRITE_DATA_AFTER]);
             auto visitor = impl.get_visitor_Expression_WRITE_DATA_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CONDITIONAL_STATEMENT& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CONDITIONAL_STATEMENT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CONDITIONAL_STATEMENT]);
             auto visitor = impl.get_visitor_Expression_CONDITIONAL_STATEMENT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CONDITIONAL_STATEMENT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CONDITIONAL_STATEMENT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CONDITIONAL_STATEMENT_BEFORE]);
             auto visitor = impl.get_visitor_Expression_CONDITIONAL_STATEMENT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CONDITIONAL_STATEMENT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CONDITIONAL_STATEMENT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CONDITIONAL_STATEMENT_AFTER]);
             auto visitor = impl.get_visitor_Expression_CONDITIONAL_STATEMENT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CONDITIONAL& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CONDITIONAL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CONDITIONAL]);
             auto visitor = impl.get_visitor_Expression_CONDITIONAL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CONDITIONAL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CONDITIONAL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CONDITIONAL_BEFORE]);
             auto visitor = impl.get_visitor_Expression_CONDITIONAL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_CONDITIONAL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_CONDITIONAL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_CONDITIONAL_AFTER]);
             auto visitor = impl.get_visitor_Expression_CONDITIONAL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_AVAILABLE& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_AVAILABLE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AVAILABLE]);
             auto visitor = impl.get_visitor_Expression_AVAILABLE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_AVAILABLE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_AVAILABLE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AVAILABLE_BEFORE]);
             auto visitor = impl.get_visitor_Expression_AVAILABLE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_AVAILABLE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_AVAILABLE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AVAILABLE_AFTER]);
             auto visitor = impl.get_visitor_Expression_AVAILABLE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SIZEOF& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SIZEOF", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SIZEOF]);
             auto visitor = impl.get_visitor_Expression_SIZEOF(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SIZEOF_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SIZEOF_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SIZEOF_BEFORE]);
             auto visitor = impl.get_visitor_Expression_SIZEOF_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SIZEOF_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SIZEOF_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SIZEOF_AFTER]);
             auto visitor = impl.get_visitor_Expression_SIZEOF_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SUB_RANGE_INIT& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SUB_RANGE_INIT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SUB_RANGE_INIT]);
             auto visitor = impl.get_visitor_Expression_SUB_RANGE_INIT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SUB_RANGE_INIT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SUB_RANGE_INIT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SUB_RANGE_INIT_BEFORE]);
             auto visitor = impl.get_visitor_Expression_SUB_RANGE_INIT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SUB_RANGE_INIT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SUB_RANGE_INIT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SUB_RANGE_INIT_AFTER]);
             auto visitor = impl.get_visitor_Expression_SUB_RANGE_INIT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_OR_COND& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_OR_COND", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_OR_COND]);
             auto visitor = impl.get_visitor_Expression_OR_COND(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_OR_COND_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_OR_COND_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_OR_COND_BEFORE]);
             auto visitor = impl.get_visitor_Expression_OR_COND_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_OR_COND_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_OR_COND_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_OR_COND_AFTER]);
             auto visitor = impl.get_visitor_Expression_OR_COND_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ADDRESS_OF& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ADDRESS_OF", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ADDRESS_OF]);
             auto visitor = impl.get_visitor_Expression_ADDRESS_OF(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ADDRESS_OF_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ADDRESS_OF_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ADDRESS_OF_BEFORE]);
             auto visitor = impl.get_visitor_Expression_ADDRESS_OF_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_ADDRESS_OF_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_ADDRESS_OF_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_ADDRESS_OF_AFTER]);
             auto visitor = impl.get_visitor_Expression_ADDRESS_OF_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_OPTIONAL_OF& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_OPTIONAL_OF", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_OPTIONAL_OF]);
             auto visitor = impl.get_visitor_Expression_OPTIONAL_OF(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_OPTIONAL_OF_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_OPTIONAL_OF_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_OPTIONAL_OF_BEFORE]);
             auto visitor = impl.get_visitor_Expression_OPTIONAL_OF_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_OPTIONAL_OF_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_OPTIONAL_OF_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_OPTIONAL_OF_AFTER]);
             auto visitor = impl.get_visitor_Expression_OPTIONAL_OF_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SETTER_STATUS& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SETTER_STATUS", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SETTER_STATUS]);
             auto visitor = impl.get_visitor_Expression_SETTER_STATUS(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SETTER_STATUS_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SETTER_STATUS_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SETTER_STATUS_BEFORE]);
             auto visitor = impl.get_visitor_Expression_SETTER_STATUS_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SETTER_STATUS_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SETTER_STATUS_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SETTER_STATUS_AFTER]);
             auto visitor = impl.get_visitor_Expression_SETTER_STATUS_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SELF& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SELF", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SELF]);
             auto visitor = impl.get_visitor_Expression_SELF(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SELF_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SELF_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SELF_BEFORE]);
             auto visitor = impl.get_visitor_Expression_SELF_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_SELF_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_SELF_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_SELF_AFTER]);
             auto visitor = impl.get_visitor_Expression_SELF_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_AS_ARG& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_AS_ARG", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AS_ARG]);
             auto visitor = impl.get_visitor_Expression_AS_ARG(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_AS_ARG_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_AS_ARG_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AS_ARG_BEFORE]);
             auto visitor = impl.get_visitor_Expression_AS_ARG_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_AS_ARG_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_AS_ARG_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AS_ARG_AFTER]);
             auto visitor = impl.get_visitor_Expression_AS_ARG_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION]);
             auto visitor = impl.get_visitor_Expression(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_BEFORE]);
             auto visitor = impl.get_visitor_Expression_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expression_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expression_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSION_AFTER]);
             auto visitor = impl.get_visitor_Expression_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expressions& ctx) {
+            CODEGEN_HOOK_PROFILE("Expressions", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSIONS]);
             auto visitor = impl.get_visitor_Expressions(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expressions_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expressions_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSIONS_BEFORE]);
             auto visitor = impl.get_visitor_Expressions_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Expressions_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Expressions_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_EXPRESSIONS_AFTER]);
             auto visitor = impl.get_visitor_Expressions_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_INT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_INT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_INT]);
             auto visitor = impl.get_visitor_Type_INT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_INT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_INT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_INT_BEFORE]);
             auto visitor = impl.get_visitor_Type_INT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_INT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_INT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_INT_AFTER]);
             auto visitor = impl.get_visitor_Type_INT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_UINT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_UINT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_UINT]);
             auto visitor = impl.get_visitor_Type_UINT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_UINT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_UINT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_UINT_BEFORE]);
             auto visitor = impl.get_visitor_Type_UINT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_UINT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_UINT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_UINT_AFTER]);
             auto visitor = impl.get_visitor_Type_UINT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_USIZE& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_USIZE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_USIZE]);
             auto visitor = impl.get_visitor_Type_USIZE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_USIZE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_USIZE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_USIZE_BEFORE]);
             auto visitor = impl.get_visitor_Type_USIZE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_USIZE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_USIZE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_USIZE_AFTER]);
             auto visitor = impl.get_visitor_Type_USIZE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_FLOAT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_FLOAT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_FLOAT]);
             auto visitor = impl.get_visitor_Type_FLOAT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_FLOAT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_FLOAT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_FLOAT_BEFORE]);
             auto visitor = impl.get_visitor_Type_FLOAT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_FLOAT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_FLOAT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_FLOAT_AFTER]);
             auto visitor = impl.get_visitor_Type_FLOAT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_STRUCT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_STRUCT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_STRUCT]);
             auto visitor = impl.get_visitor_Type_STRUCT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_STRUCT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_STRUCT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_STRUCT_BEFORE]);
             auto visitor = impl.get_visitor_Type_STRUCT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_STRUCT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_STRUCT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_STRUCT_AFTER]);
             auto visitor = impl.get_visitor_Type_STRUCT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_RECURSIVE_STRUCT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_RECURSIVE_STRUCT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_RECURSIVE_STRUCT]);
             auto visitor = impl.get_visitor_Type_RECURSIVE_STRUCT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_RECURSIVE_STRUCT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_RECURSIVE_STRUCT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_RECURSIVE_STRUCT_BEFORE]);
             auto visitor = impl.get_visitor_Type_RECURSIVE_STRUCT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_RECURSIVE_STRUCT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_RECURSIVE_STRUCT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_RECURSIVE_STRUCT_AFTER]);
             auto visitor = impl.get_visitor_Type_RECURSIVE_STRUCT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_BOOL& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_BOOL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_BOOL]);
             auto visitor = impl.get_visitor_Type_BOOL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_BOOL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_BOOL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_BOOL_BEFORE]);
             auto visitor = impl.get_visitor_Type_BOOL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_BOOL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_BOOL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_BOOL_AFTER]);
             auto visitor = impl.get_visitor_Type_BOOL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VOID& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VOID", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VOID]);
             auto visitor = impl.get_visitor_Type_VOID(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VOID_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VOID_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VOID_BEFORE]);
             auto visitor = impl.get_visitor_Type_VOID_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VOID_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VOID_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VOID_AFTER]);
             auto visitor = impl.get_visitor_Type_VOID_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_META& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_META", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_META]);
             auto visitor = impl.get_visitor_Type_META(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_META_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_META_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_META_BEFORE]);
             auto visitor = impl.get_visitor_Type_META_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_META_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_META_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_META_AFTER]);
             auto visitor = impl.get_visitor_Type_META_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENUM& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENUM", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENUM]);
             auto visitor = impl.get_visitor_Type_ENUM(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENUM_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENUM_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENUM_BEFORE]);
             auto visitor = impl.get_visitor_Type_ENUM_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENUM_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENUM_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENUM_AFTER]);
             auto visitor = impl.get_visitor_Type_ENUM_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ARRAY& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ARRAY", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ARRAY]);
             auto visitor = impl.get_visitor_Type_ARRAY(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ARRAY_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ARRAY_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ARRAY_BEFORE]);
             auto visitor = impl.get_visitor_Type_ARRAY_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ARRAY_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ARRAY_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ARRAY_AFTER]);
             auto visitor = impl.get_visitor_Type_ARRAY_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VECTOR& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VECTOR", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VECTOR]);
             auto visitor = impl.get_visitor_Type_VECTOR(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VECTOR_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VECTOR_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VECTOR_BEFORE]);
             auto visitor = impl.get_visitor_Type_VECTOR_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VECTOR_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VECTOR_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VECTOR_AFTER]);
             auto visitor = impl.get_visitor_Type_VECTOR_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VARIANT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VARIANT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VARIANT]);
             auto visitor = impl.get_visitor_Type_VARIANT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VARIANT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VARIANT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VARIANT_BEFORE]);
             auto visitor = impl.get_visitor_Type_VARIANT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_VARIANT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_VARIANT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_VARIANT_AFTER]);
             auto visitor = impl.get_visitor_Type_VARIANT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_RANGE& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_RANGE", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_RANGE]);
             auto visitor = impl.get_visitor_Type_RANGE(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_RANGE_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_RANGE_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_RANGE_BEFORE]);
             auto visitor = impl.get_visitor_Type_RANGE_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_RANGE_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_RANGE_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_RANGE_AFTER]);
             auto visitor = impl.get_visitor_Type_RANGE_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENCODER_RETURN& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENCODER_RETURN", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENCODER_RETURN]);
             auto visitor = impl.get_visitor_Type_ENCODER_RETURN(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENCODER_RETURN_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENCODER_RETURN_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENCODER_RETURN_BEFORE]);
             auto visitor = impl.get_visitor_Type_ENCODER_RETURN_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENCODER_RETURN_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENCODER_RETURN_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENCODER_RETURN_AFTER]);
             auto visitor = impl.get_visitor_Type_ENCODER_RETURN_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_DECODER_RETURN& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_DECODER_RETURN", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_DECODER_RETURN]);
             auto visitor = impl.get_visitor_Type_DECODER_RETURN(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_DECODER_RETURN_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_DECODER_RETURN_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_DECODER_RETURN_BEFORE]);
             auto visitor = impl.get_visitor_Type_DECODER_RETURN_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_DECODER_RETURN_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_DECODER_RETURN_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_DECODER_RETURN_AFTER]);
             auto visitor = impl.get_visitor_Type_DECODER_RETURN_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENCODER_INPUT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENCODER_INPUT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENCODER_INPUT]);
             auto visitor = impl.get_visitor_Type_ENCODER_INPUT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENCODER_INPUT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENCODER_INPUT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENCODER_INPUT_BEFORE]);
             auto visitor = impl.get_visitor_Type_ENCODER_INPUT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_ENCODER_INPUT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_ENCODER_INPUT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_ENCODER_INPUT_AFTER]);
             auto visitor = impl.get_visitor_Type_ENCODER_INPUT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_DECODER_INPUT& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_DECODER_INPUT", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_DECODER_INPUT]);
             auto visitor = impl.get_visitor_Type_DECODER_INPUT(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_DECODER_INPUT_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_DECODER_INPUT_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_DECODER_INPUT_BEFORE]);
             auto visitor = impl.get_visitor_Type_DECODER_INPUT_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_DECODER_INPUT_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_DECODER_INPUT_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_DECODER_INPUT_AFTER]);
             auto visitor = impl.get_visitor_Type_DECODER_INPUT_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_PROPERTY_SETTER_RETURN& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_PROPERTY_SETTER_RETURN", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_PROPERTY_SETTER_RETURN]);
             auto visitor = impl.get_visitor_Type_PROPERTY_SETTER_RETURN(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_PROPERTY_SETTER_RETURN_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_PROPERTY_SETTER_RETURN_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_PROPERTY_SETTER_RETURN_BEFORE]);
             auto visitor = impl.get_visitor_Type_PROPERTY_SETTER_RETURN_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_PROPERTY_SETTER_RETURN_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_PROPERTY_SETTER_RETURN_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_PROPERTY_SETTER_RETURN_AFTER]);
             auto visitor = impl.get_visitor_Type_PROPERTY_SETTER_RETURN_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_OPTIONAL& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_OPTIONAL", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_OPTIONAL]);
             auto visitor = impl.get_visitor_Type_OPTIONAL(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_OPTIONAL_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_OPTIONAL_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_OPTIONAL_BEFORE]);
             auto visitor = impl.get_visitor_Type_OPTIONAL_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_OPTIONAL_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_OPTIONAL_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_OPTIONAL_AFTER]);
             auto visitor = impl.get_visitor_Type_OPTIONAL_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_PTR& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_PTR", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_PTR]);
             auto visitor = impl.get_visitor_Type_PTR(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_PTR_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_PTR_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_PTR_BEFORE]);
             auto visitor = impl.get_visitor_Type_PTR_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_PTR_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_PTR_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_PTR_AFTER]);
             auto visitor = impl.get_visitor_Type_PTR_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_FUNCTION& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_FUNCTION", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_FUNCTION]);
             auto visitor = impl.get_visitor_Type_FUNCTION(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_FUNCTION_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_FUNCTION_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_FUNCTION_BEFORE]);
             auto visitor = impl.get_visitor_Type_FUNCTION_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_FUNCTION_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_FUNCTION_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_FUNCTION_AFTER]);
             auto visitor = impl.get_visitor_Type_FUNCTION_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type& ctx) {
+            CODEGEN_HOOK_PROFILE("Type", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE]);
             auto visitor = impl.get_visitor_Type(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_BEFORE]);
             auto visitor = impl.get_visitor_Type_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Type_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Type_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPE_AFTER]);
             auto visitor = impl.get_visitor_Type_after(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Types& ctx) {
+            CODEGEN_HOOK_PROFILE("Types", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPES]);
             auto visitor = impl.get_visitor_Types(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Types_before<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Types_before", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPES_BEFORE]);
             auto visitor = impl.get_visitor_Types_before(ctx);
             return visitor.visit(ctx);
         }
         expected<Result> visit(Context_Types_after<Result>& ctx) {
+            CODEGEN_HOOK_PROFILE("Types_after", hook_source_names[CODEGEN_EXPECTED_PRIORITY_TYPES_AFTER]);
             auto visitor = impl.get_visitor_Types_after(ctx);
             return visitor.visit(ctx);
         }
@@ -74852,14 +75177,16 @@ namespace ebm2rust {
     }
 }  // namespace ebm2rust
 DEFINE_ENTRY(ebm2rust::Flags, ebm2rust::Output) {
+    ebmcodegen::util::GenerationArena arena; // must outlive visitors and results
     ebm2rust::VisitorsImpl visitors_impl;
     ebm2rust::MergedVisitor visitor{flags,output,w,ebm,visitors_impl};
+    visitor.wm.track_memory = flags.mem_report;
     auto entry_function = [&]() -> ebmgen::expected<ebm2rust::Result> {
         ebm2rust::InitialContext initial_ctx{.visitor = visitor};
         auto pre_visit_result = ebm2rust::dispatch_pre_visitor(initial_ctx,ebm);
         CODEGEN_MAY_HIJACK(pre_visit_result);
         if(!visitor.module_.valid()) {
-            visitor.module_.build_maps(); // initialize mapping tables if not yet
+            flags.init_mapping(visitor.module_); // initialize mapping tables if not yet
         }
         auto entry_result = ebm2rust::dispatch_entry(initial_ctx);
         auto post_visit_result = ebm2rust::dispatch_post_entry(initial_ctx,entry_result);
@@ -74867,6 +75194,7 @@ DEFINE_ENTRY(ebm2rust::Flags, ebm2rust::Output) {
         return entry_result;
     };
     auto result = entry_function();
+    flags.record_memory(visitor.module_, visitor.wm);
     if (!result) {
         futils::wrap::cerr_wrap() << visitor.program_name << ": error: " << result.error().error();
         return 1;
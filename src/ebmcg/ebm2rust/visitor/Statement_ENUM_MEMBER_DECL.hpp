@@ -26,7 +26,7 @@ if (!ident) {
 auto enum_ident = module_.get_associated_identifier(enum_member_decl.enum_decl);
 MAYBE(enum_decl, module_.get_statement(enum_member_decl.enum_decl));
 bool has_base = !is_nil(enum_decl.body.enum_decl()->base_type);
-auto name = ident->body.data;
+auto name = module_.get_associated_identifier(item_id);
 
 MAYBE(value_str, visit_Expression(*this, enum_member_decl.value));
 
@@ -13,7 +13,7 @@
 /*here to write the hook*/
 
 ebm2rust::modify_keyword_identifier(
-    ebm, std::unordered_set<std::string_view>{
+    module_, std::unordered_set<std::string_view>{
              "as",
              "break",
              "const",
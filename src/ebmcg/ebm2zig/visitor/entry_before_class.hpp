@@ -24,6 +24,8 @@
 DEFINE_VISITOR(entry_before) {
     using namespace CODEGEN_NAMESPACE;
     auto& config = ctx.config();
+    // std import is written after all declarations are generated
+    config.allow_stream_output = false;
 
     ctx.module().register_default_prefix(ebm::StatementKind::STRUCT_DECL,"Struct");
 
@@ -725,6 +725,7 @@ namespace ebmcodegen {
         w.writeln(result_type, " visit(", context_instance_name(cls), "& ctx) {");
         {
             auto scope = w.indent_scope();
+            w.writeln("CODEGEN_HOOK_PROFILE(\"", cls.class_name(), "\", hook_source_names[", priority_check_macro_name(cls), "]);");
             w.writeln("auto visitor = impl.", get_hook_fn_name(cls), "(ctx);");
             w.writeln("return visitor.visit(ctx);");
         }
@@ -1007,6 +1008,12 @@ namespace ebmcodegen {
         }
         */
         derive.writeln("};");
+        // indexed by CODEGEN_EXPECTED_PRIORITY_*; used by CODEGEN_HOOK_PROFILE
+        w.write("constexpr const char* hook_source_names[] = {");
+        for (size_t i = 0; i < hooks.size(); i++) {
+            w.write(i ? ", " : "", "\"", hooks[i].name, "\"");
+        }
+        w.writeln("};");
         w.write_unformatted(derive.out());
         w.write_unformatted(merged.out());
     }
@@ -1257,10 +1264,57 @@ namespace ebmcodegen {
         hdr.writeln("}");
     }
 
-    void generate_generic_dispatch_default(CodeWriter& w, const ContextClass& cls, const std::string_view result_type) {
+    void for_each_kind(const ContextClass& cls, auto&& fn) {
+        auto do_for_each = [&](auto t) {
+            using T = std::decay_t<decltype(t)>;
+            for (size_t i = 0; to_string(T(i))[0]; i++) {
+                fn(to_string(T(i)));
+            }
+        };
+        if (cls.base == "Statement") {
+            do_for_each(ebm::StatementKind{});
+        }
+        else if (cls.base == "Expression") {
+            do_for_each(ebm::ExpressionKind{});
+        }
+        else if (cls.base == "Type") {
+            do_for_each(ebm::TypeKind{});
+        }
+    }
+
+    // kinds are contiguous from 0 (see for_each_kind) so kind value can be used as table index
+    void generate_table_dispatch_default(CodeWriter& w, const ContextClass& cls, const std::string_view result_type) {
+        auto class_name = cls.class_name();
+        w.writeln("template<", template_param_result(true), ", typename Context>");
+        w.writeln(result_type, " dispatch_", class_name, "_default(Context&& ctx,const ebm::", class_name, "& in,ebm::", cls.ref_name(), " alias_ref = {}) {");
+        {
+            auto scope = w.indent_scope();
+            w.writeln("using DispatchFn = ", result_type, "(*)(Context&&,const ebm::", class_name, "&,ebm::", cls.ref_name(), ");");
+            w.writeln("static constexpr DispatchFn table[] = {");
+            {
+                auto table_scope = w.indent_scope();
+                for_each_kind(cls, [&](std::string_view kind) {
+                    w.writeln("&dispatch_", cls.base, "_", kind, "<Result,Context>,");
+                });
+            }
+            w.writeln("};");
+            w.writeln("auto index = static_cast<size_t>(in.body.kind);");
+            w.writeln("if (index >= std::size(table)) {");
+            w.indent_writeln("return unexpect_error(\"Unknown ", cls.base, " kind: {}\", to_string(in.body.kind));");
+            w.writeln("}");
+            w.writeln("return table[index](std::forward<Context>(ctx),in,alias_ref);");
+        }
+        w.writeln("}");
+    }
+
+    void generate_generic_dispatch_default(CodeWriter& w, const ContextClass& cls, const std::string_view result_type, bool dispatch_table) {
         if (!cls.has(ContextClassKind_Generic)) {
             return;
         }
+        if (dispatch_table) {
+            generate_table_dispatch_default(w, cls, result_type);
+            return;
+        }
         auto class_name = cls.class_name();
         w.writeln("template<", template_param_result(true), ", typename Context>");
         w.writeln(result_type, " dispatch_", class_name, "_default(Context&& ctx,const ebm::", class_name, "& in,ebm::", cls.ref_name(), " alias_ref = {}) {");
@@ -1269,26 +1323,14 @@ namespace ebmcodegen {
             w.writeln("switch(in.body.kind) {");
             {
                 auto switch_scope = w.indent_scope();
-                auto do_for_each = [&](auto t) {
-                    using T = std::decay_t<decltype(t)>;
-                    for (size_t i = 0; to_string(T(i))[0]; i++) {
-                        w.writeln("case ebm::", cls.base, "Kind::", to_string(T(i)), ": {");
-                        {
-                            auto case_scope = w.indent_scope();
-                            w.writeln("return dispatch_", cls.base, "_", to_string(T(i)), "<Result>(std::forward<Context>(ctx),in,alias_ref);");
-                        }
-                        w.writeln("}");
+                for_each_kind(cls, [&](std::string_view kind) {
+                    w.writeln("case ebm::", cls.base, "Kind::", kind, ": {");
+                    {
+                        auto case_scope = w.indent_scope();
+                        w.writeln("return dispatch_", cls.base, "_", kind, "<Result>(std::forward<Context>(ctx),in,alias_ref);");
                     }
-                };
-                if (cls.base == "Statement") {
-                    do_for_each(ebm::StatementKind{});
-                }
-                else if (cls.base == "Expression") {
-                    do_for_each(ebm::ExpressionKind{});
-                }
-                else if (cls.base == "Type") {
-                    do_for_each(ebm::TypeKind{});
-                }
+                    w.writeln("}");
+                });
                 w.writeln("default: {");
                 {
                     auto default_scope = w.indent_scope();
@@ -1691,8 +1733,10 @@ namespace ebmcodegen {
         w.writeln("DEFINE_ENTRY(", ns_name, "::Flags, ", ns_name, "::Output) {");
         {
             auto scope = w.indent_scope();
+            w.writeln("ebmcodegen::util::GenerationArena arena; // must outlive visitors and results");
             w.writeln(ns_name, "::VisitorsImpl visitors_impl;");
             w.writeln(ns_name, "::MergedVisitor visitor{flags,output,w,ebm,visitors_impl};");
+            w.writeln("visitor.wm.track_memory = flags.mem_report;");
             w.writeln("auto entry_function = [&]() -> ", fq_result_type, " {");
             {
                 auto entry_scope = w.indent_scope();
@@ -1700,7 +1744,7 @@ namespace ebmcodegen {
                 w.writeln("auto pre_visit_result = ", ns_name, "::dispatch_pre_visitor(initial_ctx,ebm);");
                 handle_hijack_logic(w, "pre_visit_result");
                 w.writeln("if(!visitor.module_.valid()) {");
-                w.indent_writeln("visitor.module_.build_maps(); // initialize mapping tables if not yet");
+                w.indent_writeln("flags.init_mapping(visitor.module_); // initialize mapping tables if not yet");
                 w.writeln("}");
                 w.writeln("auto entry_result = ", ns_name, "::dispatch_entry(initial_ctx);");
                 w.writeln("auto post_visit_result = ", ns_name, "::dispatch_post_entry(initial_ctx,entry_result);");
@@ -1709,6 +1753,7 @@ namespace ebmcodegen {
             }
             w.writeln("};");
             w.writeln("auto result = entry_function();");
+            w.writeln("flags.record_memory(visitor.module_, visitor.wm);");
             w.writeln("if (!result) {");
             {
                 auto err_scope = w.indent_scope();
@@ -1934,7 +1979,7 @@ namespace ebmcodegen {
         generate_hijack_logic_macro(src);
         for (auto& cls_group : context_classes) {
             generate_dispatcher_function(hdr, src, cls_group, result_type);
-            generate_generic_dispatch_default(hdr, cls_group.main(), result_type);
+            generate_generic_dispatch_default(hdr, cls_group.main(), result_type, locations.dispatch_table);
             generate_traversal_children_for_class(hdr, src, cls_group.main(), result_type, structs);
         }
         generate_generic_traversal_children(hdr, src, context_classes, result_type);
@@ -21,9 +21,7 @@
 #include "../codegen.hpp"
 DEFINE_VISITOR(Expression_dispatch_after) {
     using namespace CODEGEN_NAMESPACE;
-    if (!ctx.result.has_value()) {
-        return pass;
-    }
-    ctx.config().expression_memoization_config.try_memoize(get_id(ctx.in.id), ctx.in.body.kind, ctx.result->to_writer());
+    // also called on error to close the rendering scope opened by Expression_dispatch_before
+    ctx.config().expression_memoization_config.try_memoize(get_id(ctx.in.id), ctx.in.body.kind, ctx.result);
     return pass;
 }
@@ -18,21 +18,220 @@
         container: std::vector<StatementRef>
 */
 /*DO NOT EDIT ABOVE SECTION MANUALLY*/
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <string>
 #include "../codegen.hpp"
+#include "ebmcodegen/stub/dependency.hpp"
+#include "ebmcodegen/stub/incremental.hpp"
 DEFINE_VISITOR(Statement_PROGRAM_DECL) {
     using namespace CODEGEN_NAMESPACE;
+    const auto& container = ctx.block.container;
+    if (ctx.config().parallel_toplevel) {
+        return CodeWriter{};  // worker of render_toplevel_parallel; declarations are rendered by it
+    }
+    auto render_on = [&](auto& visitor, size_t i) -> expected<CodeWriter> {
+        MAYBE(stmt_code, visit_Statement(visitor, container[i]));
+        CodeWriter chunk;
+        for (auto& toplevel : visitor.decl_toplevel) {
+            chunk.writeln(toplevel);
+        }
+        visitor.decl_toplevel.clear();
+        chunk.write(stmt_code.to_writer());
+        return chunk;
+    };
+    auto render = [&](size_t i) {
+        return render_on(get_visitor(ctx), i);
+    };
+    // see toplevel_state_hash in Visitor.hpp; without hooks declarations do not depend on state
+    auto state_hash = [](auto& visitor) -> std::uint64_t {
+        return visitor.toplevel_state_hash ? visitor.toplevel_state_hash() : 0;
+    };
+    auto item_begin = [](auto& visitor) {
+        if (visitor.toplevel_item_begin) {
+            visitor.toplevel_item_begin();
+        }
+    };
+    auto item_end = [](auto& visitor) -> std::string {
+        return visitor.toplevel_item_end ? visitor.toplevel_item_end() : std::string{};
+    };
+    auto replay = [](auto& visitor, std::string_view effect) -> expected<void> {
+        if (visitor.toplevel_item_replay) {
+            return visitor.toplevel_item_replay(effect);
+        }
+        return {};
+    };
+    auto reset = [](auto& visitor) {
+        if (visitor.toplevel_state_reset) {
+            visitor.toplevel_state_reset();
+        }
+    };
+    // with --stream-output each declaration is written to root as soon as it is generated
+    // (declarations are generated in block order), so it is not kept in memory
+    const bool stream = ctx.flags().stream_output && ctx.config().allow_stream_output;
     CodeWriter w;
+    auto emit = [&](CodeWriter& chunk) {
+        if (stream) {
+            auto line = ctx.visitor.wm.write_root(chunk);
+            convert_location_info(ctx, chunk, line);
+        }
+        else {
+            w.write(std::move(chunk));
+        }
+    };
+    CodeWriter start;
     if (ctx.config().program_decl_start_wrapper) {
         MAYBE(result, ctx.config().program_decl_start_wrapper(ctx));
-        w.write(std::move(result.to_writer()));
+        start.write(std::move(result.to_writer()));
     }
-    for (const auto& stmt : ctx.block.container) {
-        MAYBE(stmt_code, ctx.visit(stmt));
-        for (auto& toplevel : ctx.config().decl_toplevel) {
-            w.writeln(toplevel);
+    emit(start);
+    const size_t jobs = ctx.config().allow_parallel_toplevel ? std::min(ctx.flags().jobs, container.size()) : 1;
+    // with --incremental-cache declarations whose fingerprint and starting state (toplevel_state_hash) are unchanged
+    // are taken from cache instead of rendered, and state changes they made are replayed (toplevel_item_replay)
+    // line maps are not cached, so cache is not used while they are requested (--test-info)
+    std::optional<ebmcodegen::util::IncrementalCache> cache;
+    std::vector<std::uint64_t> fingerprints;
+    if (ctx.flags().incremental_cache.size() && ctx.config().allow_parallel_toplevel && ctx.flags().dump_test_file.empty() && jobs <= 1) {
+        ctx.flags().incremental_cache_used = true;
+        cache.emplace(ctx.flags().invocation_fingerprint);
+        cache->load(ctx.flags().incremental_cache);
+        MAYBE(graph, struct_graph(ctx));
+        for (auto& ref : container) {
+            fingerprints.push_back(toplevel_fingerprint(ctx, graph, ref));
+        }
+    }
+    auto finish = [&]() -> expected<void> {
+        if (cache) {
+            MAYBE_VOID(saved, cache->save(ctx.flags().incremental_cache));
+            if (ctx.flags().timing) {
+                futils::wrap::cerr_wrap() << ctx.visitor.program_name << ": incremental cache: " << cache->reused << "/" << container.size() << " declarations reused\n";
+            }
+        }
+        return {};
+    };
+    auto& names = ctx.visitor.output.struct_names;
+    if (jobs > 1) {
+        // first round renders every declaration on workers from state right after entry hooks (toplevel_state_reset).
+        // their effects are replayed in declaration order to find state each one starts from in sequential generation,
+        // and second round renders again declarations whose starting state differs, from replayed state.
+        // if replayed state before or after one of them differs from state on worker, that one and
+        // following ones are rendered here sequentially, so output is always same as sequential generation
+        const auto size = container.size();
+        ebmcodegen::util::ParallelToplevel<CodeWriter> shared(size);
+        std::vector<std::uint64_t> start_hashes(size), end_hashes(size);
+        std::vector<std::string> predicted;  // effects of first round
+        std::atomic<size_t> sequential_from = size;
+        auto lower_sequential_from = [&](size_t i) {
+            auto current = sequential_from.load();
+            while (i < current && !sequential_from.compare_exchange_weak(current, i)) {
+            }
+        };
+        const auto initial_hash = state_hash(get_visitor(ctx));
+        size_t round = 0;
+        MAYBE_VOID(rendered, render_toplevel_parallel(
+                                 get_visitor(ctx), shared, jobs,
+                                 [](auto& worker) {
+                                     InitialContext initial_ctx{.visitor = worker};
+                                     return dispatch_entry(initial_ctx);
+                                 },
+                                 [&](auto& worker) -> expected<void> {
+                                     auto& worker_names = worker.output.struct_names;
+                                     size_t replayed = size;  // effects applied to worker since reset; size if not reset yet
+                                     while (auto i = shared.claim()) {
+                                         if (round == 0) {
+                                             reset(worker);
+                                         }
+                                         else {
+                                             if (replayed > *i) {
+                                                 reset(worker);
+                                                 replayed = 0;
+                                             }
+                                             for (; replayed < *i; replayed++) {
+                                                 MAYBE_VOID(applied, replay(worker, predicted[replayed]));
+                                             }
+                                             if (state_hash(worker) != start_hashes[*i]) {
+                                                 lower_sequential_from(*i);
+                                                 return {};
+                                             }
+                                         }
+                                         auto prev = worker_names.size();
+                                         item_begin(worker);
+                                         shared.chunks[*i] = render_on(worker, *i);
+                                         shared.effects[*i] = item_end(worker);
+                                         shared.struct_names[*i].assign(worker_names.begin() + prev, worker_names.end());
+                                         if (round != 0) {
+                                             if (state_hash(worker) != end_hashes[*i]) {
+                                                 lower_sequential_from(*i + 1);
+                                                 return {};
+                                             }
+                                             replayed = *i + 1;
+                                         }
+                                     }
+                                     return {};
+                                 },
+                                 [&](auto& worker) -> expected<bool> {
+                                     if (round++ != 0) {
+                                         return false;
+                                     }
+                                     reset(worker);
+                                     if (state_hash(worker) != initial_hash) {
+                                         sequential_from = 0;
+                                         return false;
+                                     }
+                                     predicted = shared.effects;
+                                     shared.items.clear();
+                                     for (size_t i = 0; i < size; i++) {
+                                         start_hashes[i] = state_hash(worker);
+                                         if (start_hashes[i] != initial_hash) {
+                                             shared.items.push_back(i);
+                                             shared.chunks[i].reset();  // on this thread while no worker runs; see GenerationArena::fork
+                                         }
+                                         MAYBE_VOID(applied, replay(worker, predicted[i]));
+                                         end_hashes[i] = state_hash(worker);
+                                     }
+                                     return !shared.items.empty();
+                                 }));
+        // merged in block order; effects of rendered declarations are replayed so that
+        // this visitor ends with same state as sequential generation (e.g. imports)
+        for (size_t i = 0; i < size; i++) {
+            if (i >= sequential_from) {
+                MAYBE(chunk, render(i));
+                emit(chunk);
+                continue;
+            }
+            if (!shared.chunks[i]) {
+                return unexpect_error("top-level statement {} was not rendered", i);
+            }
+            MAYBE(chunk, std::move(*shared.chunks[i]));
+            MAYBE_VOID(applied, replay(get_visitor(ctx), shared.effects[i]));
+            names.insert(names.end(), shared.struct_names[i].begin(), shared.struct_names[i].end());
+            emit(chunk);
+        }
+        MAYBE_VOID(finished, finish());
+        return w;
+    }
+    for (size_t i = 0; i < container.size(); i++) {
+        if (!cache) {
+            MAYBE(chunk, render(i));
+            emit(chunk);
+            continue;
+        }
+        const auto key = ebmgen::hash_mix(fingerprints[i], state_hash(get_visitor(ctx)));
+        if (auto entry = cache->find(key)) {
+            names.insert(names.end(), entry->struct_names.begin(), entry->struct_names.end());
+            MAYBE_VOID(applied, replay(get_visitor(ctx), entry->effect));
+            CodeWriter chunk;
+            chunk.write_unformatted(entry->text);
+            emit(chunk);
+            continue;
         }
-        ctx.config().decl_toplevel.clear();
-        w.write(stmt_code.to_writer());
+        auto prev = names.size();
+        item_begin(get_visitor(ctx));
+        MAYBE(chunk, render(i));
+        cache->record(key, chunk.to_string(), {names.begin() + prev, names.end()}, item_end(get_visitor(ctx)));
+        emit(chunk);
     }
+    MAYBE_VOID(finished, finish());
     return w;
 }
\ No newline at end of file
@@ -21,7 +21,7 @@
 #include "../codegen.hpp"
 DEFINE_VISITOR(Type_dispatch_after) {
     using namespace CODEGEN_NAMESPACE;
-    /*here to write the hook*/
-    ctx.config().type_memoization_config.try_memoize(get_id(ctx.in.id), ctx.in.body.kind, ctx.result->to_writer());
+    // also called on error to close the rendering scope opened by Type_dispatch_before
+    ctx.config().type_memoization_config.try_memoize(get_id(ctx.in.id), ctx.in.body.kind, ctx.result);
     return pass;
 }
@@ -9,6 +9,20 @@
 bool use_brace_for_condition = true;
 bool use_elif = false;
 bool auto_output_root = true;
+bool allow_stream_output = true;  // set false if PROGRAM_DECL result is wrapped after main_logic (--stream-output)
+// set true if rendering a top-level declaration does not depend on config state left by previous ones,
+// or if that state is exposed by toplevel_* hooks below (--jobs, --incremental-cache)
+bool allow_parallel_toplevel = false;
+ebmcodegen::util::ParallelToplevel<CodeWriter>* parallel_toplevel = nullptr;  // set on worker visitors
+// hash of config state that rendering a top-level declaration reads; part of incremental cache key
+std::function<std::uint64_t()> toplevel_state_hash;
+// called around rendering a top-level declaration; end returns state changes made by it (effect)
+std::function<void()> toplevel_item_begin;
+std::function<std::string()> toplevel_item_end;
+// applies effect returned by toplevel_item_end as if the declaration was rendered on this visitor
+std::function<expected<void>(std::string_view effect)> toplevel_item_replay;
+// restores state to what it was right after entry hooks (--jobs)
+std::function<void()> toplevel_state_reset;
 bool methods_inner_class = false;
 std::string bool_true = "true";
 std::string bool_false = "false";
@@ -147,25 +161,85 @@ std::function<expected<Result>(Context_Statement_LENGTH_CHECK& ctx)> length_chec
 
 template <class Kind>
 struct MemoizationConfig {
+    struct Key {
+        std::uint64_t id = 0;
+        std::uint64_t context = 0;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return std::hash<std::uint64_t>{}(key.id * 0x9e3779b97f4a7c15 ^ key.context);
+        }
+    };
+    struct Entry {
+        CodeWriter result;
+        std::vector<std::string> depends;  // invalidation keys
+    };
+
     bool enable = false;
     bool target_kind_as_exclusive = false;
     std::unordered_set<Kind> target_kinds;
-    std::unordered_map<std::uint64_t, CodeWriter> memoized_items;
+    // config state that changes rendering of same item (e.g. inner_element_type, on_assign)
+    // results rendered under different state are cached separately
+    // other state read by hooks must be declared by depends_on (and invalidated when it changes)
+    // or kinds reading it excluded by target_kinds
+    std::function<std::uint64_t()> context_key;
+    std::unordered_map<Key, Entry, KeyHash> memoized_items;
+    // invalidation key -> items rendered while the key was declared by depends_on
+    std::unordered_map<std::string, std::vector<Key>> dependents;
+    // invalidation keys declared while rendering each item in progress (innermost last)
+    std::vector<std::set<std::string>> rendering;
+
+    Key make_key(std::uint64_t id) const {
+        return Key{id, context_key ? context_key() : 0};
+    }
 
     expected<Result> try_get_memoized(std::uint64_t id) {
         if (!enable) {
             return pass;
         }
-        auto found = memoized_items.find(id);
+        auto found = memoized_items.find(make_key(id));
         if (found != memoized_items.end()) {
-            auto copy = found->second;
+            if (!rendering.empty()) {
+                // outer item contains this result so it depends on same state
+                rendering.back().insert(found->second.depends.begin(), found->second.depends.end());
+            }
+            auto copy = found->second.result;
             return copy;
         }
+        rendering.emplace_back();
         return pass;
     }
 
-    void try_memoize(std::uint64_t id, Kind kind, const CodeWriter& result) {
-        if (!enable) {
+    // called by hooks whose result depends on state other than context_key
+    // result of items being rendered is dropped by invalidate(key)
+    void depends_on(std::string_view key) {
+        if (!rendering.empty()) {
+            rendering.back().emplace(key);
+        }
+    }
+
+    void invalidate(std::string_view key) {
+        auto found = dependents.find(std::string(key));
+        if (found == dependents.end()) {
+            return;
+        }
+        for (auto& item : found->second) {
+            memoized_items.erase(item);
+        }
+        dependents.erase(found);
+    }
+
+    void try_memoize(std::uint64_t id, Kind kind, const expected<Result>& result) {
+        if (!enable || rendering.empty()) {
+            return;
+        }
+        auto depends = std::move(rendering.back());
+        rendering.pop_back();
+        if (!rendering.empty()) {
+            rendering.back().insert(depends.begin(), depends.end());
+        }
+        if (!result) {
             return;
         }
         if (target_kind_as_exclusive) {
@@ -178,7 +252,11 @@ struct MemoizationConfig {
                 return;
             }
         }
-        memoized_items[id] = result;
+        auto key = make_key(id);
+        for (auto& dep : depends) {
+            dependents[dep].push_back(key);
+        }
+        memoized_items[key] = Entry{.result = result->to_writer(), .depends = {depends.begin(), depends.end()}};
     }
 };
 
@@ -19,6 +19,9 @@ DEFINE_VISITOR(entry) {
     auto& root = ctx.visitor.wm.root;
     MAYBE(entry_point, ctx.get_entry_point());
     MAYBE(result, ctx.visit(entry_point));
+    if (ctx.config().parallel_toplevel) {
+        return {};  // worker visitor; rendered declarations are collected by main visitor
+    }
     ctx.flags().debug_timing("code generated");
     if (ctx.config().auto_output_root) {
         root.write_unformatted(result.to_string());
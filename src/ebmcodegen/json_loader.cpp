@@ -1,6 +1,7 @@
 /*license*/
 #include "stub/structs.hpp"
 #include <code/code_writer.h>
+#include <format>
 
 namespace ebmcodegen {
 
@@ -88,4 +89,138 @@ namespace ebmcodegen {
         w.writeln("}");
         return w.out();
     }
+
+    // group by length of name so that generated code can switch on length before comparing chars
+    template <class T>
+    std::map<size_t, std::vector<const T*>> group_by_name_length(const std::vector<T>& items) {
+        std::map<size_t, std::vector<const T*>> groups;
+        for (auto& item : items) {
+            groups[item.name.size()].push_back(&item);
+        }
+        return groups;
+    }
+
+    std::string write_convert_from_json_stream(const Struct& s) {
+        CodeWriter w;
+        w.writeln("bool from_json_stream(", s.name, "& obj, ::ebmgen::JSONStreamReader& r) {");
+        {
+            auto scope = w.indent_scope();
+            if (s.is_any_ref) {
+                w.writeln("std::uint64_t id;");
+                w.writeln("if (!r.read_uint(id)) {");
+                w.indent_writeln("return false;");
+                w.writeln("}");
+                w.writeln("obj = ", s.name, "{id};");
+                w.writeln("return true;");
+            }
+            else {
+                // bit for each required field
+                std::map<std::string_view, std::uint64_t> required_bits;
+                std::uint64_t required_mask = 0;
+                for (auto& field : s.fields) {
+                    if (!(field.attr & TypeAttribute::PTR)) {
+                        auto bit = std::uint64_t(1) << required_bits.size();
+                        required_bits[field.name] = bit;
+                        required_mask |= bit;
+                    }
+                }
+                if (required_mask) {
+                    w.writeln("std::uint64_t found = 0;");
+                }
+                w.writeln("auto ok = r.read_object([&](std::string_view key) {");
+                {
+                    auto obj_scope = w.indent_scope();
+                    w.writeln("switch (key.size()) {");
+                    {
+                        auto switch_scope = w.indent_scope();
+                        for (auto& [length, fields] : group_by_name_length(s.fields)) {
+                            w.writeln("case ", length, ": {");
+                            {
+                                auto case_scope = w.indent_scope();
+                                for (auto field : fields) {
+                                    w.writeln("if (key == \"", field->name, "\") {");
+                                    auto if_scope = w.indent_scope();
+                                    if (auto found = required_bits.find(field->name); found != required_bits.end()) {
+                                        w.writeln("found |= ", std::format("0x{:x}", found->second), ";");
+                                    }
+                                    if (field->attr & TypeAttribute::PTR || field->attr & TypeAttribute::RVALUE) {
+                                        auto type = std::string(field->type);
+                                        if (field->attr & TypeAttribute::ARRAY) {
+                                            type = "std::vector<" + type + ">";
+                                        }
+                                        w.writeln(type, " tmp;");
+                                        w.writeln("if (!from_json_stream(tmp, r)) {");
+                                        w.indent_writeln("return false;");
+                                        w.writeln("}");
+                                        if (!(field->attr & TypeAttribute::PTR) && type == "bool") {
+                                            w.writeln("obj.", field->name, "(std::move(tmp));");
+                                            w.writeln("return true;");
+                                        }
+                                        else {
+                                            w.writeln("return bool(obj.", field->name, "(std::move(tmp)));");
+                                        }
+                                    }
+                                    else {
+                                        w.writeln("return from_json_stream(obj.", field->name, ", r);");
+                                    }
+                                    if_scope.execute();
+                                    w.writeln("}");
+                                }
+                                w.writeln("break;");
+                            }
+                            w.writeln("}");
+                        }
+                    }
+                    w.writeln("}");
+                    w.writeln("return r.skip_value();");
+                }
+                w.writeln("});");
+                if (required_mask) {
+                    w.writeln("return ok && (found & ", std::format("0x{:x}", required_mask), ") == ", std::format("0x{:x}", required_mask), ";");
+                }
+                else {
+                    w.writeln("return ok;");
+                }
+            }
+        }
+        w.writeln("}");
+        return w.out();
+    }
+
+    std::string write_convert_from_json_stream(const Enum& e) {
+        CodeWriter w;
+        w.writeln("bool from_json_stream(", e.name, "& obj, ::ebmgen::JSONStreamReader& r) {");
+        {
+            auto scope = w.indent_scope();
+            w.writeln("std::string_view s;");
+            w.writeln("if (!r.read_string(s)) {");
+            w.indent_writeln("return false;");
+            w.writeln("}");
+            w.writeln("switch (s.size()) {");
+            {
+                auto switch_scope = w.indent_scope();
+                for (auto& [length, members] : group_by_name_length(e.members)) {
+                    w.writeln("case ", length, ": {");
+                    {
+                        auto case_scope = w.indent_scope();
+                        for (auto member : members) {
+                            w.writeln("if (s == \"", member->name, "\") {");
+                            {
+                                auto if_scope = w.indent_scope();
+                                w.writeln("obj = ", e.name, "::", member->name, ";");
+                                w.writeln("return true;");
+                            }
+                            w.writeln("}");
+                        }
+                        w.writeln("break;");
+                    }
+                    w.writeln("}");
+                }
+            }
+            w.writeln("}");
+            w.writeln("return false;");
+        }
+        w.writeln("}");
+        return w.out();
+    }
 }  // namespace ebmcodegen
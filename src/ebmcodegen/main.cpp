@@ -30,6 +30,8 @@ enum class GenerateMode {
     BodySubset,
     JSONConverterHeader,
     JSONConverterSource,
+    JSONStreamConverterHeader,
+    JSONStreamConverterSource,
     CMake,
     CodeGenerator,
     ClassBasedCodeGeneratorHeader,
@@ -54,6 +56,7 @@ struct Flags : futils::cmdline::templ::HelpOption {
     std::string_view default_visitor_impl_dir = "ebmcodegen/default_codegen_visitor/";
     std::string_view template_target;
     std::string_view dsl_file;
+    bool dispatch_table = false;
 
     void bind(futils::cmdline::option::Context& ctx) {
         bind_help(ctx);
@@ -64,12 +67,15 @@ struct Flags : futils::cmdline::templ::HelpOption {
         ctx.VarString<true>(&default_visitor_impl_dir, "default-visitor-impl-dir", "directory for default visitor implementation", "DIR");
         ctx.VarString<true>(&template_target, "template-target", "template target name. see --mode hooklist", "target_name");
         ctx.VarString<true>(&dsl_file, "dsl-file", "DSL source file for --mode dsl", "FILE");
+        ctx.VarBool(&dispatch_table, "dispatch-table", "dispatch Statement/Expression/Type kinds through function pointer table instead of switch (class based modes)");
         ctx.VarMap(&mode, "mode", "generate mode (default: codegen)", "{subset,codegen,interpret,hooklist,hookkind,template,spec-json,dsl,accessor,ebmgen-visitor,codegen-class-header,codegen-class-source,interpret-class-header,interpret-class-source}",
                    std::map<std::string, GenerateMode>{
                        {"template", GenerateMode::Template},
                        {"subset", GenerateMode::BodySubset},
                        {"json-conv-header", GenerateMode::JSONConverterHeader},
                        {"json-conv-source", GenerateMode::JSONConverterSource},
+                       {"json-stream-header", GenerateMode::JSONStreamConverterHeader},
+                       {"json-stream-source", GenerateMode::JSONStreamConverterSource},
                        {"cmake", GenerateMode::CMake},
                        {"codegen", GenerateMode::CodeGenerator},
                        {"codegen-class-header", GenerateMode::ClassBasedCodeGeneratorHeader},
@@ -207,35 +213,14 @@ int print_cmake(CodeWriter& w, Flags& flags) {
     w.writeln("add_executable(", target_name);
     w.indent_writeln("\"main.cpp\"");
     w.writeln(")");
-    w.write("target_precompile_headers(", target_name, " ");
-    // codegen.hpp includes user generated code so exclude from this
-    w.write_unformatted(R"(PRIVATE
-    <format>
-    <expected>
-    <string>
-    <vector>
-    <variant>
-    <optional>
-    <ebm/extended_binary_module.hpp>
-    <ebmcodegen/stub/entry.hpp>
-    <ebmcodegen/stub/util.hpp>
-    <ebmgen/common.hpp>
-    <ebmgen/convert/helper.hpp>
-    <ebmgen/mapping.hpp>
-    <code/code_writer.h>
-    <code/loc_writer.h>
-    <ebmcodegen/stub/writer_manager.hpp>
-    <concepts>
-    <strutil/append.h>
-)
-)");
     w.writeln("if(UNIX)");
     w.writeln("set_target_properties(", target_name, " PROPERTIES INSTALL_RPATH \"${CMAKE_SOURCE_DIR}/tool\")");
     w.writeln("endif()");
-    w.writeln("target_link_libraries(", target_name, " ebm futils ebm_mapping)");
+    // language independent headers and build options are shared through ebmcodegen_core (see top level CMakeLists.txt)
+    w.writeln("target_link_libraries(", target_name, " ebmcodegen_core)");
+    w.writeln("target_precompile_headers(", target_name, " REUSE_FROM ebmcodegen_core)");
     w.writeln("install(TARGETS ", target_name, " DESTINATION tool)");
     w.writeln("if (\"$ENV{BUILD_MODE}\" STREQUAL \"web\")");
-    w.indent_writeln("target_compile_options(", target_name, " PUBLIC \"-gsource-map\")");
     w.indent_writeln("target_link_options(", target_name, " PUBLIC \"-gsource-map\" \"--source-map-base\" \"http://localhost:8000/\")");
     w.indent_writeln("install(FILES \"${CMAKE_BINARY_DIR}/tool/", target_name, ".wasm\" DESTINATION tool)");
     w.indent_writeln("install(FILES \"${CMAKE_BINARY_DIR}/tool/", target_name, ".wasm.map\" DESTINATION tool)");
@@ -367,6 +352,43 @@ int print_json_converter(CodeWriter& w, bool src) {
     return 0;
 }
 
+int print_json_stream_converter(CodeWriter& w, bool src) {
+    auto [struct_map, enum_map] = ebmcodegen::make_struct_map(true);
+    if (src) {
+        w.writeln("#include \"json_stream_conv.hpp\"");  // decoders refer each other
+    }
+    else {
+        w.writeln("#pragma once");
+        w.writeln("#include <ebm/extended_binary_module.hpp>");
+        w.writeln("#include <ebmgen/json_stream.hpp>");
+    }
+    w.writeln("namespace ebm {");
+    {
+        auto scope = w.indent_scope();
+        for (auto& s : struct_map) {
+            if (src) {
+                w.write_unformatted(ebmcodegen::write_convert_from_json_stream(s.second));
+            }
+            else {
+                w.writeln("bool from_json_stream(", s.second.name, "& obj, ::ebmgen::JSONStreamReader& r);");
+            }
+            w.writeln();
+        }
+        for (auto& e : enum_map) {
+            if (src) {
+                w.write_unformatted(ebmcodegen::write_convert_from_json_stream(e.second));
+            }
+            else {
+                w.writeln("bool from_json_stream(", e.second.name, "& obj, ::ebmgen::JSONStreamReader& r);");
+            }
+            w.writeln();
+        }
+    }
+    w.writeln("} // namespace ebm");
+    cout << w.out();
+    return 0;
+}
+
 int print_body_subset(CodeWriter& w, std::map<std::string_view, ebmcodegen::Struct>& struct_map) {
     w.writeln("#include <ebm/extended_binary_module.hpp>");
     w.writeln("#include <set>");
@@ -480,6 +502,10 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
         write_header();
         return print_json_converter(w, flags.mode == GenerateMode::JSONConverterSource);
     }
+    if (flags.mode == GenerateMode::JSONStreamConverterSource || flags.mode == GenerateMode::JSONStreamConverterHeader) {
+        write_header();
+        return print_json_stream_converter(w, flags.mode == GenerateMode::JSONStreamConverterSource);
+    }
     auto [struct_map, enum_map] = ebmcodegen::make_struct_map();
     if (flags.mode == GenerateMode::SpecJSON) {
         return print_spec_json(struct_map, enum_map);
@@ -527,6 +553,7 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
     locations.program_name = flags.program_name;
     locations.is_codegen = (flags.mode == GenerateMode::ClassBasedCodeGeneratorHeader || flags.mode == GenerateMode::ClassBasedCodeGeneratorSource);
     locations.ebmgen_mode = (flags.mode == GenerateMode::EbmgenVisitor);
+    locations.dispatch_table = flags.dispatch_table;
 
     if (flags.mode == GenerateMode::ClassBasedCodeGeneratorHeader || flags.mode == GenerateMode::ClassBasedCodeGeneratorSource ||
         flags.mode == GenerateMode::ClassBasedInterpreterHeader || flags.mode == GenerateMode::ClassBasedInterpreterSource ||
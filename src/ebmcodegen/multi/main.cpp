@@ -0,0 +1,175 @@
+/*license*/
+// ebmcodegen-multi: run several generators on one loaded EBM
+// generators are linked with EBMCODEGEN_MULTI (see top level CMakeLists.txt) and registered by DEFINE_ENTRY
+#include <cmdline/template/help_option.h>
+#include <cmdline/template/parse_and_err.h>
+#include <ebm/extended_binary_module.hpp>
+#include <ebmcodegen/stub/hook_profile.hpp>
+#include <ebmcodegen/stub/multi.hpp>
+#include <ebmgen/stdin.hpp>
+#include <file/file_stream.h>
+#include <file/file_view.h>
+#include <strutil/splits.h>
+#include <wrap/argv.h>
+#include <wrap/cout.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+auto& cout = futils::wrap::cout_wrap();
+auto& cerr = futils::wrap::cerr_wrap();
+
+struct Flags : futils::cmdline::templ::HelpOption {
+    std::string_view input;
+    std::string_view targets;
+    bool list = false;
+
+    void bind(futils::cmdline::option::Context& ctx) {
+        bind_help(ctx);
+        ctx.VarString<true>(&input, "input,i", "input EBM file", "FILE");
+        ctx.VarString<true>(&targets, "targets,t", "semicolon separated list of GENERATOR=OUTPUT[,FLAG...] (e.g. \"ebm2go=out.go;ebm2c=out.c,--flag\")", "LIST");
+        ctx.VarBool(&list, "list", "list linked generators");
+    }
+};
+
+struct Target {
+    std::string name;
+    std::string output;
+    std::vector<std::string> args;  // args[0] is name
+};
+
+int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
+    auto& generators = ebmcodegen::multi::generators();
+    if (flags.list) {
+        for (auto& [name, _] : generators) {
+            cout << name << "\n";
+        }
+        return 0;
+    }
+    if (flags.input.empty()) {
+        cerr << "ebmcodegen-multi: no input file\n";
+        return 1;
+    }
+    std::vector<Target> targets;
+    for (auto& spec : futils::strutil::split<std::string>(flags.targets, ";")) {
+        if (spec.empty()) {
+            continue;
+        }
+        auto args = futils::strutil::split<std::string>(spec, ",");
+        auto eq = args[0].find('=');
+        if (eq == std::string::npos || eq + 1 == args[0].size()) {
+            cerr << "ebmcodegen-multi: invalid target " << spec << " (expected GENERATOR=OUTPUT)\n";
+            return 1;
+        }
+        Target target{.name = args[0].substr(0, eq), .output = args[0].substr(eq + 1)};
+        if (!generators.contains(target.name)) {
+            cerr << "ebmcodegen-multi: unknown generator " << target.name << " (see --list)\n";
+            return 1;
+        }
+        if (target.output == "-") {
+            cerr << "ebmcodegen-multi: " << target.name << ": output must be a file\n";
+            return 1;
+        }
+        target.args.push_back(target.name);
+        target.args.insert(target.args.end(), args.begin() + 1, args.end());
+        targets.push_back(std::move(target));
+    }
+    if (targets.empty()) {
+        cerr << "ebmcodegen-multi: no targets\n";
+        return 1;
+    }
+
+    // load, decode and build mapping tables once; shared read only by all generators
+    ebmgen::Stdin stdin_data;
+    futils::file::View view;
+    futils::binary::reader r{futils::view::rvec{}};
+    if (flags.input == "-") {
+        auto stdin_result = stdin_data.try_read_stdin();
+        if (!stdin_result) {
+            cerr << "ebmcodegen-multi: failed to read stdin: " << stdin_result.error().error<std::string>() << '\n';
+            return 1;
+        }
+        r.reset_buffer(*stdin_data.stdin_data);
+    }
+    else {
+        if (auto res = view.open(flags.input); !res) {
+            cerr << "ebmcodegen-multi: " << res.error().template error<std::string>() << '\n';
+            return 1;
+        }
+        if (!view.data()) {
+            cerr << "ebmcodegen-multi: Empty file\n";
+            return 1;
+        }
+        r.reset_buffer(view);
+    }
+    ebm::ExtendedBinaryModule ebm;
+    if (auto err = ebm.decode(r)) {
+        cerr << "ebmcodegen-multi: " << err.error<std::string>() << '\n';
+        return 1;
+    }
+    if (!r.empty()) {
+        cerr << "ebmcodegen-multi: unexpected remaining data for input\n";
+        return 1;
+    }
+    ebmgen::MappingTable table(ebm);
+
+    std::vector<int> results(targets.size(), 1);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t i = 0; i < targets.size(); i++) {
+            threads.emplace_back([&, i] {
+                auto& target = targets[i];
+                auto file = futils::file::File::create(target.output);
+                if (!file) {
+                    cerr << "ebmcodegen-multi: " << target.name << ": " << file.error().template error<std::string>() << '\n';
+                    return;
+                }
+                futils::file::FileStream<std::string> fs{*file};
+                futils::binary::writer w{fs.get_direct_write_handler(), &fs};
+                std::vector<char*> argv;
+                for (auto& arg : target.args) {
+                    argv.push_back(arg.data());
+                }
+                argv.push_back(nullptr);
+                results[i] = generators.at(target.name)(int(target.args.size()), argv.data(), ebm, table, w);
+            });
+        }
+    }
+#if defined(EBMCODEGEN_HOOK_PROFILE)
+    {
+        std::stringstream ss;
+        ebmcodegen::print_hook_profile(ss);
+        cerr << ss.str();
+    }
+#endif
+    int ret = 0;
+    for (size_t i = 0; i < targets.size(); i++) {
+        if (results[i] != 0) {
+            cerr << "ebmcodegen-multi: " << targets[i].name << " failed\n";
+            ret = 1;
+        }
+    }
+    return ret;
+}
+
+int ebmcodegen_multi_main(int argc, char** argv) {
+    Flags flags;
+    return futils::cmdline::templ::parse_or_err<std::string>(
+        argc, argv, flags,
+        [](auto&& str, bool err) {
+            if (err)
+                cerr << str;
+            else
+                cout << str;
+        },
+        [](Flags& flags, futils::cmdline::option::Context& ctx) {
+            return Main(flags, ctx);
+        });
+}
+
+int main(int argc, char** argv) {
+    futils::wrap::U8Arg _(argc, argv);
+    return ebmcodegen_multi_main(argc, argv);
+}
@@ -0,0 +1,75 @@
+/*license*/
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+#include <helper/defer.h>
+
+namespace ebmcodegen::util {
+    // per generation arena for generator temporaries (CODE/CODELINE/SEPARATED writers and their location entries)
+    // installed for current thread while alive, and all allocations are released at once on destruction
+    // so that objects allocated while it is installed must not outlive it
+    // freed blocks (e.g. nodes copied on write or chunks already written by stream output) are pooled and reused,
+    // so memory is bounded by live writers rather than by everything allocated during the run
+    struct GenerationArena {
+        GenerationArena()
+            : previous_(current()), previous_owner_(owner()) {
+            current() = &resource_;
+            owner() = this;
+        }
+
+        GenerationArena(const GenerationArena&) = delete;
+        GenerationArena& operator=(const GenerationArena&) = delete;
+
+        ~GenerationArena() {
+            current() = previous_;
+            owner() = previous_owner_;
+        }
+
+        // innermost arena of current thread or default resource if none
+        static std::pmr::memory_resource* resource() {
+            auto r = current();
+            return r ? r : std::pmr::get_default_resource();
+        }
+
+        // resource for another thread (unsynchronized_pool_resource is not thread safe)
+        // released together with innermost arena of current thread, so results rendered
+        // by worker threads can be used (and freed) by current thread after the workers exit
+        // while workers run, objects allocated by current thread must not be released on worker threads
+        static std::pmr::memory_resource* fork() {
+            auto arena = owner();
+            if (!arena) {
+                return std::pmr::get_default_resource();
+            }
+            std::lock_guard lock(arena->children_mutex_);
+            return arena->children_.emplace_back(std::make_unique<std::pmr::unsynchronized_pool_resource>()).get();
+        }
+
+        // use resource on current thread until returned object is destroyed
+        [[nodiscard]] static auto install(std::pmr::memory_resource* resource) {
+            auto previous = current();
+            current() = resource;
+            return futils::helper::defer([previous] {
+                current() = previous;
+            });
+        }
+
+       private:
+        std::pmr::unsynchronized_pool_resource resource_;
+        std::pmr::memory_resource* previous_;
+        GenerationArena* previous_owner_;
+        std::mutex children_mutex_;
+        std::vector<std::unique_ptr<std::pmr::unsynchronized_pool_resource>> children_;
+
+        static std::pmr::memory_resource*& current() {
+            thread_local std::pmr::memory_resource* ptr = nullptr;
+            return ptr;
+        }
+
+        static GenerationArena*& owner() {
+            thread_local GenerationArena* ptr = nullptr;
+            return ptr;
+        }
+    };
+}  // namespace ebmcodegen::util
@@ -13,6 +13,7 @@ namespace ebmcodegen {
         std::vector<LocationInfo> include_locations;
         bool is_codegen = false;
         bool ebmgen_mode = false;
+        bool dispatch_table = false;  // dispatch kinds by function pointer table instead of switch
 
         std::string_view lang;
         std::string_view program_name;
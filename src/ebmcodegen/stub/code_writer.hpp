@@ -3,8 +3,17 @@
 #include "code/loc_writer.h"
 #include <vector>
 #include "ebm/extended_binary_module.hpp"
+#include "arena.hpp"
+#if defined(EBMCODEGEN_ROPE_WRITER)
+#include "rope_writer.hpp"
+#endif
 
 namespace ebmcodegen::util {
+#if defined(EBMCODEGEN_ROPE_WRITER)
+    // set env EBMCODEGEN_ROPE_WRITER=1 on cmake configure
+    using CodeWriter = RopeWriter<ebm::AnyRef>;
+#else
     using CodeWriter = futils::code::LocWriter<std::string, std::vector, ebm::AnyRef>;
+#endif
 
 }
\ No newline at end of file
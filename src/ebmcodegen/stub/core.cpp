@@ -0,0 +1,17 @@
+/*license*/
+// host of precompiled header shared by generated code generators (ebmcodegen_core)
+// keep generator independent: must not include anything under visitor/
+#include <ebmcodegen/stub/entry.hpp>
+#include <ebmcodegen/stub/util.hpp>
+#include <ebmcodegen/stub/writer_manager.hpp>
+
+// set by CMakeLists.txt; empty when built by other means (incremental cache is then keyed on command line only)
+#ifndef EBMCODEGEN_SOURCE_HASH
+#define EBMCODEGEN_SOURCE_HASH ""
+#endif
+
+namespace ebmcodegen::internal {
+    std::string_view source_hash() {
+        return EBMCODEGEN_SOURCE_HASH;
+    }
+}  // namespace ebmcodegen::internal
@@ -7,19 +7,26 @@
 #include "ebmcodegen/stub/util.hpp"
 #include "ebmgen/access.hpp"
 #include "ebmgen/common.hpp"
+#include "ebmgen/fingerprint.hpp"
 #include "ebmgen/mapping.hpp"
 namespace ebmcodegen::util {
 
-    ebmgen::expected<std::vector<ebm::StatementRef>> sorted_struct(auto&& ctx) {
-        ebmgen::MappingTable& module_ = get_visitor(ctx).module_;
+    // 構造体IDをキーとして、その参照と依存先リストを保持する構造
+    struct StructNode {
+        ebm::StatementRef ref;
+        std::vector<std::uint64_t> deps;
+    };
 
-        // 構造体IDをキーとして、その参照と依存先リストを保持する構造
-        struct Node {
-            ebm::StatementRef ref;
-            std::vector<std::uint64_t> deps;
-        };
-        std::unordered_map<std::uint64_t, Node> struct_graph;
+    struct StructGraph {
+        std::unordered_map<std::uint64_t, StructNode> nodes;
         std::vector<std::uint64_t> order_of_appearance;
+    };
+
+    ebmgen::expected<StructGraph> struct_graph(auto&& ctx) {
+        ebmgen::MappingTable& module_ = get_visitor(ctx).module_;
+        StructGraph graph;
+        auto& struct_graph = graph.nodes;
+        auto& order_of_appearance = graph.order_of_appearance;
 
         auto do_handle = [&](ebm::StatementRef stmt_ref, const ebm::StructDecl* struct_ptr) -> ebmgen::expected<void> {
             uint64_t id = get_id(stmt_ref);
@@ -45,7 +52,7 @@ namespace ebmcodegen::util {
             });
 
             if (!res) return ebmgen::unexpect_error(std::move(res.error()));
-            struct_graph[id] = Node{stmt_ref, std::move(deps)};
+            struct_graph[id] = StructNode{stmt_ref, std::move(deps)};
             return {};
         };
 
@@ -67,6 +74,13 @@ namespace ebmcodegen::util {
             }
             MAYBE_VOID(ok, do_handle(ref, struct_decl));
         }
+        return graph;
+    }
+
+    ebmgen::expected<std::vector<ebm::StatementRef>> sorted_struct(auto&& ctx) {
+        // 1. 構造体の依存関係グラフを構築する
+        MAYBE(graph, struct_graph(ctx));
+        auto& struct_graph = graph.nodes;
 
         // 2. トポロジカルソートの実行
         std::vector<ebm::StatementRef> result;
@@ -87,10 +101,37 @@ namespace ebmcodegen::util {
             visited.insert(id);
         };
 
-        for (uint64_t id : order_of_appearance) {
+        for (uint64_t id : graph.order_of_appearance) {
             visit(visit, id);
         }
 
         return result;
     }
+
+    // fingerprint of top-level statement for incremental generation (--incremental-cache)
+    // covers objects reachable from the statement (MappingTable::fingerprint) and
+    // structs it depends on transitively, which are only referenced weakly from field types
+    std::uint64_t toplevel_fingerprint(auto&& ctx, const StructGraph& graph, ebm::StatementRef ref) {
+        const ebmgen::MappingTable& module_ = get_visitor(ctx).module_;
+        std::unordered_set<std::uint64_t> visited{get_id(ref)};
+        std::vector<std::uint64_t> stack{get_id(ref)};
+        std::uint64_t deps = 0;  // sum so that it does not depend on traversal order
+        while (!stack.empty()) {
+            auto it = graph.nodes.find(stack.back());
+            stack.pop_back();
+            if (it == graph.nodes.end()) {
+                continue;
+            }
+            for (auto dep : it->second.deps) {
+                if (!visited.insert(dep).second) {
+                    continue;
+                }
+                if (auto found = graph.nodes.find(dep); found != graph.nodes.end()) {
+                    deps += module_.fingerprint(found->second.ref);
+                    stack.push_back(dep);
+                }
+            }
+        }
+        return ebmgen::hash_mix(module_.fingerprint(ref), deps);
+    }
 }  // namespace ebmcodegen::util
\ No newline at end of file
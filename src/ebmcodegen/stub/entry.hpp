@@ -11,7 +11,10 @@
 #include <json/stringer.h>
 #include <set>
 #include <unordered_map>
+#include "ebmgen/fingerprint.hpp"
 #include "ebmgen/mapping.hpp"
+#include "ebmgen/mem_report.hpp"
+#include "hook_profile.hpp"
 #include "ebmgen/stdin.hpp"
 #include "flags.hpp"
 #if defined(__EMSCRIPTEN__)
@@ -31,6 +34,9 @@ namespace ebmcodegen {
         constexpr bool is_web_type_allowed(std::string_view type_name) {
             return type_name == "file";
         }
+
+        // content hash of generator sources computed at configure time (defined in core.cpp)
+        std::string_view source_hash();
     }  // namespace internal
 
     struct Flags : futils::cmdline::templ::HelpOption {
@@ -40,6 +46,14 @@ namespace ebmcodegen {
         bool show_flags = false;
         bool timing = false;
         bool source_map = false;
+        bool mem_report = false;
+        bool stream_output = false;
+        size_t jobs = 1;
+        std::string_view incremental_cache;
+        std::uint64_t invocation_fingerprint = 0;  // generator sources and command line; key of incremental cache
+        bool incremental_cache_used = false;       // set by generator that supports --incremental-cache
+        ebmgen::MemoryReport memory;
+        const ebmgen::MappingTable* shared_mapping = nullptr;  // built once by ebmcodegen-multi for all targets
         Timepoint start{};
         Timepoint prev{};
         // std::vector<std::string_view> args;
@@ -69,6 +83,14 @@ namespace ebmcodegen {
             return "";
         }
 
+        // keyed on source hash rather than build time so that rebuilding same sources keeps cache
+        void set_invocation(int argc, char** argv) {
+            invocation_fingerprint = ebmgen::hash_string(internal::source_hash());
+            for (int i = 0; i < argc; i++) {
+                invocation_fingerprint = ebmgen::hash_mix(invocation_fingerprint, ebmgen::hash_string(argv[i]));
+            }
+        }
+
         void debug_timing(const char* phase) {
             if (timing) {
                 auto now = Timepoint{};
@@ -79,6 +101,30 @@ namespace ebmcodegen {
             }
         }
 
+        void warn_unused_incremental_cache() {
+            if (incremental_cache.size() && !incremental_cache_used) {
+                futils::wrap::cerr_wrap() << program_name << ": warning: --incremental-cache ignored (not supported by this generator or disabled by --test-info or --jobs)\n";
+            }
+        }
+
+        // called by generated entry after pre_visitor if mapping tables are not built yet
+        void init_mapping(ebmgen::MappingTable& table) {
+            if (shared_mapping && table.share_maps(*shared_mapping)) {
+                return;
+            }
+            table.build_maps();
+        }
+
+        // called by generated entry after generation to add generator side numbers
+        void record_memory(const ebmgen::MappingTable& table, auto& wm) {
+            if (mem_report) {
+                memory.mapping = table.memory_usage();
+                auto usage = wm.memory_usage;
+                usage.output_bytes = wm.root.out().offset();
+                memory.writer = usage;
+            }
+        }
+
         void bind(futils::cmdline::option::Context& ctx) {
             bind_help(ctx);
             ctx.VarString<true>(&input, "input,i", "input EBM file", "FILE");
@@ -89,6 +135,10 @@ namespace ebmcodegen {
             ctx.VarString<true>(&dump_test_separator, "test-separator", "dump test info separator when dumping test info to stdout", "SEP");
             ctx.VarBool(&debug_unimplemented, "debug-unimplemented", "debug unimplemented node (for debug)");
             ctx.VarBool(&timing, "timing", "show timing info (for debug)");
+            ctx.VarBool(&mem_report, "mem-report", "show memory usage report at exit (for debug)");
+            ctx.VarBool(&stream_output, "stream-output", "write each top-level declaration to output as soon as it is generated (if supported by generator)");
+            ctx.VarInt(&jobs, "jobs", "number of threads to generate top-level declarations (if supported by generator)", "N");
+            ctx.VarString<true>(&incremental_cache, "incremental-cache", "reuse top-level declarations whose fingerprint is unchanged since previous run, and update cache FILE (if supported by generator)", "FILE");
             ctx.VarBoolFunc(&source_map, "source-map", "Generates WebPlayground/API Server compatible source-map output (same as --test-info - --test-separator \"############\")", [&](bool flag, auto) {
                 if (flag) {
                     dump_test_file = "-";
@@ -102,10 +152,46 @@ namespace ebmcodegen {
                 }
                 return true;
             });
-            web_filtered = {"help", "input", "output", "show-flags", "dump-code", "test-info", "test-separator", "timing"};
+            web_filtered = {"help", "input", "output", "show-flags", "dump-code", "test-info", "test-separator", "timing", "mem-report", "stream-output", "jobs", "incremental-cache"};
         }
     };
     namespace internal {
+        // reports after generation (--incremental-cache warning, --mem-report and --test-info)
+        // shared by load_file and ebmcodegen-multi (run_loaded)
+        int finish_generation(auto& flags, auto& output, const ebm::ExtendedBinaryModule& ebm, int ret) {
+            auto& cout = futils::wrap::cout_wrap();
+            auto& cerr = futils::wrap::cerr_wrap();
+            flags.warn_unused_incremental_cache();
+            if (flags.mem_report) {
+                ebmgen::collect_module_memory(flags.memory, ebm);
+                flags.memory.peak_rss = ebmgen::peak_rss_bytes();
+                std::stringstream ss;
+                ebmgen::print_memory_report(ss, flags.memory);
+                cerr << ss.str();
+            }
+            if (flags.dump_test_file.size()) {
+                futils::json::Stringer str;
+                auto obj = str.object();
+                obj("line_map", output.line_maps);
+                obj("structs", output.struct_names);
+                obj.close();
+                if (flags.dump_test_file == "-") {
+                    cout << flags.dump_test_separator;
+                    cout << str.out() << "\n";
+                    return ret;
+                }
+                auto file = futils::file::File::create(flags.dump_test_file);
+                if (!file) {
+                    cerr << flags.program_name << ": " << file.error().template error<std::string>() << '\n';
+                    return 1;
+                }
+                futils::file::FileStream<std::string> fs{*file};
+                futils::binary::writer w{fs.get_direct_write_handler(), &fs};
+                w.write(str.out());
+            }
+            return ret;
+        }
+
         int load_file(auto& flags, auto& output, futils::cmdline::option::Context& ctx, auto&& then) {
             if (flags.show_flags) {
                 futils::wrap::cout_wrap() << flag_description_json(ctx, flags.lang_name, flags.ui_lang_name, flags.lsp_name, flags.webworker_name, flags.file_extensions, flags.web_filtered, flags.web_type_map) << '\n';
@@ -171,51 +257,86 @@ namespace ebmcodegen {
             futils::binary::writer w{fs.get_direct_write_handler(), &fs};
             flags.debug_timing("file loaded");
             int ret = then(w, ebm, output);
-            if (flags.dump_test_file.size()) {
-                futils::json::Stringer str;
-                auto obj = str.object();
-                obj("line_map", output.line_maps);
-                obj("structs", output.struct_names);
-                obj.close();
-                if (flags.dump_test_file == "-") {
-                    cout << flags.dump_test_separator;
-                    cout << str.out() << "\n";
-                    return ret;
-                }
-                auto file = futils::file::File::create(flags.dump_test_file);
-                if (!file) {
-                    cerr << flags.program_name << ": " << file.error().template error<std::string>() << '\n';
-                    return 1;
-                }
-                futils::file::FileStream<std::string> fs{*file};
-                futils::binary::writer w{fs.get_direct_write_handler(), &fs};
-                w.write(str.out());
+            ret = finish_generation(flags, output, ebm, ret);
+#if defined(EBMCODEGEN_HOOK_PROFILE)
+            {
+                std::stringstream ss;
+                ebmcodegen::print_hook_profile(ss);
+                cerr << ss.str();
             }
+#endif
             return ret;
         }
     }  // namespace internal
 }  // namespace ebmcodegen
 
+// main is expanded by DEFINE_ENTRY in generator's main.cpp
+// because this header is also compiled into ebmcodegen_core which is linked to every generator
+#if defined(__EMSCRIPTEN__)
+#define EBMCODEGEN_DEFINE_MAIN()                                                  \
+    extern "C" int EMSCRIPTEN_KEEPALIVE emscripten_main(const char* cmdline) { \
+        return em_main(cmdline, ebmcodegen_main);                              \
+    }
+#else
+#define EBMCODEGEN_DEFINE_MAIN()            \
+    int main(int argc, char** argv) {       \
+        futils::wrap::U8Arg _(argc, argv);  \
+        return ebmcodegen_main(argc, argv); \
+    }
+#endif
+
+#if defined(EBMCODEGEN_MULTI)
+#include "multi.hpp"
+namespace ebmcodegen::multi {
+    // same as ebmcodegen_main but with already decoded module and mapping table
+    template <class FlagType, class OutputType>
+    int run_loaded(int argc, char** argv, ebm::ExtendedBinaryModule& ebm, const ebmgen::MappingTable& table, futils::binary::writer& w, auto&& main_fn) {
+        FlagType flags;
+        OutputType output;
+        flags.program_name = argv[0];
+        flags.set_invocation(argc, argv);
+        return futils::cmdline::templ::parse_or_err<std::string>(
+            argc, argv, flags, [&](auto&& str, bool err) {
+                if (err) {
+                    futils::wrap::cerr_wrap() << flags.program_name << ": " << str;
+                }
+                else {
+                    futils::wrap::cout_wrap() << str;
+                } },
+            [&](FlagType& flags, futils::cmdline::option::Context& ctx) {
+                // stdout is shared by all targets
+                if (flags.dump_test_file == "-") {
+                    futils::wrap::cerr_wrap() << flags.program_name << ": --test-info must be a file (--source-map is not supported)\n";
+                    return 1;
+                }
+                flags.shared_mapping = &table;
+                int ret = main_fn(flags, ctx, w, ebm, output);
+                return internal::finish_generation(flags, output, ebm, ret);
+            });
+    }
+}  // namespace ebmcodegen::multi
+// linked into ebmcodegen-multi together with other generators;
+// EBMCODEGEN_MULTI_NAME (set per source file) is the name used to select this generator
+#define DEFINE_ENTRY(FlagType, OutputType)                                                                                                          \
+    static int Main(FlagType& flags, futils::cmdline::option::Context& ctx, futils::binary::writer& w, ebm::ExtendedBinaryModule& ebm, OutputType& output); \
+    static const bool ebmcodegen_multi_registered = ebmcodegen::multi::register_generator(                                                         \
+        EBMCODEGEN_MULTI_NAME, [](int argc, char** argv, ebm::ExtendedBinaryModule& ebm, const ebmgen::MappingTable& table, futils::binary::writer& w) { \
+            return ebmcodegen::multi::run_loaded<FlagType, OutputType>(argc, argv, ebm, table, w, Main);                                                  \
+        });                                                                                                                                          \
+    static int Main(FlagType& flags, futils::cmdline::option::Context& ctx, futils::binary::writer& w, ebm::ExtendedBinaryModule& ebm, OutputType& output)
+#else
 #define DEFINE_ENTRY(FlagType, OutputType)                                                                                                                                                                                    \
     int Main(FlagType& flags, futils::cmdline::option::Context& ctx, futils::binary::writer& w, ebm::ExtendedBinaryModule& ebm, OutputType& output);                                                                          \
     int ebmcodegen_main(int argc, char** argv) {                                                                                                                                                                              \
         FlagType flags;                                                                                                                                                                                                       \
         OutputType output;                                                                                                                                                                                                    \
         flags.program_name = argv[0];                                                                                                                                                                                         \
+        flags.set_invocation(argc, argv);                                                                                                                                                                                     \
         return futils::cmdline::templ::parse_or_err<std::string>(                                                                                                                                                             \
             argc, argv, flags, [&](auto&& str, bool err) {  if(err){ futils::wrap::cerr_wrap()<< flags.program_name << ": " <<str; } else { futils::wrap::cout_wrap() << str;} },                                                                                                                                                                 \
             [&](FlagType& flags, futils::cmdline::option::Context& ctx) { return ebmcodegen::internal::load_file(flags, output, ctx, [&](auto& w, auto& ebm, auto& output) { return Main(flags, ctx, w, ebm, output); }); }); \
     }                                                                                                                                                                                                                         \
+    EBMCODEGEN_DEFINE_MAIN()                                                                                                                                                                                                  \
     int Main(FlagType& flags, futils::cmdline::option::Context& ctx, futils::binary::writer& w, ebm::ExtendedBinaryModule& ebm, OutputType& output)
 
-int ebmcodegen_main(int argc, char** argv);
-#if defined(__EMSCRIPTEN__)
-extern "C" int EMSCRIPTEN_KEEPALIVE emscripten_main(const char* cmdline) {
-    return em_main(cmdline, ebmcodegen_main);
-}
-#else
-int main(int argc, char** argv) {
-    futils::wrap::U8Arg _(argc, argv);
-    return ebmcodegen_main(argc, argv);
-}
 #endif
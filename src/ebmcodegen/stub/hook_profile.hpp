@@ -0,0 +1,134 @@
+/*license*/
+#pragma once
+// per-hook call count and time profiler for generated visitor dispatch
+// enabled only when compiled with EBMCODEGEN_HOOK_PROFILE (set env EBMCODEGEN_HOOK_PROFILE=1 on cmake configure)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <ostream>
+#include <string_view>
+#include <vector>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace ebmcodegen {
+    inline std::uint64_t read_cycle_counter() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+        std::uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    // one site per MergedVisitor::visit function; registered on first call
+    struct HookProfileSite {
+        const char* hook;
+        const char* source;  // hook type selected by CODEGEN_EXPECTED_PRIORITY_*
+        std::atomic<std::uint64_t> calls = 0;
+        std::atomic<std::uint64_t> total_ticks = 0;
+        std::atomic<std::uint64_t> self_ticks = 0;  // excluding nested hooks
+        HookProfileSite* next = nullptr;
+
+        HookProfileSite(const char* hook, const char* source);
+    };
+
+    struct HookProfileRegistry {
+        std::atomic<HookProfileSite*> head = nullptr;
+        // for converting ticks to time
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        std::uint64_t start_ticks = read_cycle_counter();
+
+        static HookProfileRegistry& instance() {
+            static HookProfileRegistry registry;
+            return registry;
+        }
+
+        void add(HookProfileSite* site) {
+            auto current = head.load(std::memory_order_relaxed);
+            do {
+                site->next = current;
+            } while (!head.compare_exchange_weak(current, site, std::memory_order_release, std::memory_order_relaxed));
+        }
+    };
+
+    inline HookProfileSite::HookProfileSite(const char* hook, const char* source)
+        : hook(hook), source(source) {
+        HookProfileRegistry::instance().add(this);
+    }
+
+    struct HookProfileScope {
+        HookProfileSite& site;
+        std::uint64_t start = read_cycle_counter();
+        std::uint64_t child_ticks = 0;
+        std::uint64_t* parent_child_ticks = current();
+
+        explicit HookProfileScope(HookProfileSite& site)
+            : site(site) {
+            current() = &child_ticks;
+        }
+
+        HookProfileScope(const HookProfileScope&) = delete;
+
+        ~HookProfileScope() {
+            auto elapsed = read_cycle_counter() - start;
+            site.calls.fetch_add(1, std::memory_order_relaxed);
+            site.total_ticks.fetch_add(elapsed, std::memory_order_relaxed);
+            site.self_ticks.fetch_add(elapsed > child_ticks ? elapsed - child_ticks : 0, std::memory_order_relaxed);
+            current() = parent_child_ticks;
+            if (parent_child_ticks) {
+                *parent_child_ticks += elapsed;
+            }
+        }
+
+       private:
+        static std::uint64_t*& current() {
+            thread_local std::uint64_t* ptr = nullptr;
+            return ptr;
+        }
+    };
+
+    // sorted by self time
+    inline void print_hook_profile(std::ostream& os) {
+        auto& registry = HookProfileRegistry::instance();
+        auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - registry.start_time).count();
+        auto elapsed_ticks = read_cycle_counter() - registry.start_ticks;
+        double ns_per_tick = elapsed_ticks ? double(elapsed_ns) / double(elapsed_ticks) : 0;
+        std::vector<const HookProfileSite*> sites;
+        for (auto site = registry.head.load(std::memory_order_acquire); site; site = site->next) {
+            if (site->calls.load(std::memory_order_relaxed)) {
+                sites.push_back(site);
+            }
+        }
+        std::ranges::sort(sites, std::greater<>{}, [](const HookProfileSite* site) {
+            return site->self_ticks.load(std::memory_order_relaxed);
+        });
+        auto ms = [&](std::uint64_t ticks) {
+            return double(ticks) * ns_per_tick / 1e6;
+        };
+        os << std::format("{:<48} {:<34} {:>10} {:>12} {:>12} {:>10}\n", "hook", "source", "calls", "total(ms)", "self(ms)", "avg(us)");
+        for (auto site : sites) {
+            auto calls = site->calls.load(std::memory_order_relaxed);
+            auto total = site->total_ticks.load(std::memory_order_relaxed);
+            os << std::format("{:<48} {:<34} {:>10} {:>12.3f} {:>12.3f} {:>10.3f}\n", site->hook, site->source, calls,
+                              ms(total), ms(site->self_ticks.load(std::memory_order_relaxed)), ms(total) * 1000 / calls);
+        }
+    }
+}  // namespace ebmcodegen
+
+#if defined(EBMCODEGEN_HOOK_PROFILE)
+#define CODEGEN_HOOK_PROFILE(hook, source)                                   \
+    static ebmcodegen::HookProfileSite hook_profile_site__{hook, source}; \
+    ebmcodegen::HookProfileScope hook_profile_scope__ { hook_profile_site__ }
+#else
+#define CODEGEN_HOOK_PROFILE(hook, source)
+#endif
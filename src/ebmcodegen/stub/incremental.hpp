@@ -0,0 +1,137 @@
+/*license*/
+#pragma once
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <file/file_stream.h>
+#include <file/file_view.h>
+#include "ebmgen/common.hpp"
+
+namespace ebmcodegen::util {
+    struct IncrementalEntry {
+        std::string text;
+        std::vector<std::string> struct_names;  // appended to Output while rendering
+        std::string effect;                     // returned by toplevel_item_end; replayed when reused
+    };
+
+    // sidecar cache of rendered top-level declarations keyed on their fingerprint and state left by previous ones (--incremental-cache)
+    // cache made with other generator sources or flags (key) is discarded as a whole
+    // format:
+    //   ebmcodegen-incremental <key>\n
+    //   (<fingerprint> <text size> <struct name count> <effect size>\n (<struct name>\n)* <text>\n <effect>\n)*
+    struct IncrementalCache {
+        static constexpr std::string_view magic = "ebmcodegen-incremental";
+        std::uint64_t key = 0;
+        std::unordered_map<std::uint64_t, IncrementalEntry> entries;  // loaded from file
+        std::unordered_map<std::uint64_t, IncrementalEntry> next;     // saved to file; only declarations of this run
+        size_t reused = 0;
+
+        explicit IncrementalCache(std::uint64_t key)
+            : key(key) {}
+
+        // missing, broken or stale cache is not an error; everything is rendered again
+        void load(std::string_view path) {
+            futils::file::View view;
+            if (!view.open(path) || !view.data()) {
+                return;
+            }
+            std::string_view data(reinterpret_cast<const char*>(view.data()), view.size());
+            auto line = [&]() -> std::string_view {
+                auto pos = data.find('\n');
+                if (pos == data.npos) {
+                    data = {};
+                    return {};
+                }
+                auto l = data.substr(0, pos);
+                data = data.substr(pos + 1);
+                return l;
+            };
+            auto number = [](std::string_view& str, std::uint64_t& out, int base = 10) {
+                auto res = std::from_chars(str.data(), str.data() + str.size(), out, base);
+                if (res.ec != std::errc{}) {
+                    return false;
+                }
+                str = str.substr(res.ptr - str.data());
+                if (str.starts_with(' ')) {
+                    str = str.substr(1);
+                }
+                return true;
+            };
+            auto header = line();
+            std::uint64_t file_key = 0;
+            if (!header.starts_with(magic) || !header.substr(magic.size()).starts_with(' ')) {
+                return;
+            }
+            header = header.substr(magic.size() + 1);
+            if (!number(header, file_key, 16) || file_key != key) {
+                return;
+            }
+            std::unordered_map<std::uint64_t, IncrementalEntry> loaded;
+            while (!data.empty()) {
+                auto desc = line();
+                std::uint64_t fingerprint = 0, size = 0, names = 0, effect_size = 0;
+                if (!number(desc, fingerprint, 16) || !number(desc, size) || !number(desc, names) || !number(desc, effect_size)) {
+                    return;
+                }
+                IncrementalEntry entry;
+                for (std::uint64_t i = 0; i < names; i++) {
+                    if (data.empty()) {
+                        return;
+                    }
+                    entry.struct_names.push_back(std::string(line()));
+                }
+                if (data.size() < size + 1 || data[size] != '\n') {
+                    return;
+                }
+                entry.text = std::string(data.substr(0, size));
+                data = data.substr(size + 1);
+                if (data.size() < effect_size + 1 || data[effect_size] != '\n') {
+                    return;
+                }
+                entry.effect = std::string(data.substr(0, effect_size));
+                data = data.substr(effect_size + 1);
+                loaded.emplace(fingerprint, std::move(entry));
+            }
+            entries = std::move(loaded);
+        }
+
+        const IncrementalEntry* find(std::uint64_t fingerprint) {
+            auto it = entries.find(fingerprint);
+            if (it == entries.end()) {
+                return nullptr;
+            }
+            reused++;
+            return &next.insert_or_assign(fingerprint, it->second).first->second;
+        }
+
+        void record(std::uint64_t fingerprint, std::string text, std::vector<std::string> struct_names, std::string effect) {
+            next.insert_or_assign(fingerprint, IncrementalEntry{std::move(text), std::move(struct_names), std::move(effect)});
+        }
+
+        ebmgen::expected<void> save(std::string_view path) const {
+            auto file = futils::file::File::create(path);
+            if (!file) {
+                return ebmgen::unexpect_error("failed to create incremental cache {}: {}", path, file.error().template error<std::string>());
+            }
+            futils::file::FileStream<std::string> fs{*file};
+            futils::binary::writer w{fs.get_direct_write_handler(), &fs};
+            w.write(std::format("{} {:x}\n", magic, key));
+            for (auto& [fingerprint, entry] : next) {
+                w.write(std::format("{:x} {} {} {}\n", fingerprint, entry.text.size(), entry.struct_names.size(), entry.effect.size()));
+                for (auto& name : entry.struct_names) {
+                    w.write(name);
+                    w.write("\n");
+                }
+                w.write(entry.text);
+                w.write("\n");
+                w.write(entry.effect);
+                w.write("\n");
+            }
+            return {};
+        }
+    };
+}  // namespace ebmcodegen::util
@@ -0,0 +1,27 @@
+/*license*/
+#pragma once
+// registry of generators linked into ebmcodegen-multi (EBMCODEGEN_MULTI)
+// each generated main.cpp registers its entry by DEFINE_ENTRY instead of defining main()
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <binary/writer.h>
+#include <ebm/extended_binary_module.hpp>
+#include <ebmgen/mapping.hpp>
+
+namespace ebmcodegen::multi {
+    // argv[0] is generator name, and rest are generator flags (input file is already loaded)
+    // ebm and table are shared by all generators running concurrently, so hooks must not modify module
+    // (rename identifiers by MappingTable::set_identifier_modifier instead)
+    using GeneratorEntry = std::function<int(int argc, char** argv, ebm::ExtendedBinaryModule& ebm, const ebmgen::MappingTable& table, futils::binary::writer& w)>;
+
+    inline std::map<std::string_view, GeneratorEntry>& generators() {
+        static std::map<std::string_view, GeneratorEntry> map;
+        return map;
+    }
+
+    inline bool register_generator(std::string_view name, GeneratorEntry entry) {
+        return generators().emplace(name, std::move(entry)).second;
+    }
+}  // namespace ebmcodegen::multi
@@ -0,0 +1,110 @@
+/*license*/
+#pragma once
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "arena.hpp"
+#include "ebmgen/common.hpp"
+
+namespace ebmcodegen::util {
+    // shared by main visitor and worker visitors of parallel top-level generation (--jobs)
+    // each worker claims items by next_item and writes only slots of claimed items
+    template <class CodeWriter>
+    struct ParallelToplevel {
+        std::atomic<size_t> next_item = 0;
+        std::vector<size_t> items;  // indices of declarations rendered in current round, ascending
+        std::vector<std::optional<ebmgen::expected<CodeWriter>>> chunks;
+        std::vector<std::vector<std::string>> struct_names;  // appended to Output while rendering each item
+        std::vector<std::string> effects;                    // toplevel_item_end after rendering each item
+
+        explicit ParallelToplevel(size_t items)
+            : chunks(items), struct_names(items), effects(items) {
+            for (size_t i = 0; i < items; i++) {
+                this->items.push_back(i);
+            }
+        }
+
+        // claims next item of current round
+        std::optional<size_t> claim() {
+            auto i = next_item++;
+            if (i >= items.size()) {
+                return std::nullopt;
+            }
+            return items[i];
+        }
+    };
+
+    // render top-level items with jobs worker visitors in rounds
+    // worker is a fresh visitor of same type as visitor with its own config, writers, output and mapping table,
+    // and run_entry(worker) runs entry hooks on it once so that config is initialized same as main visitor
+    // (Statement_PROGRAM_DECL of worker visitor renders nothing)
+    // each round render_items(worker) renders items claimed from shared on every worker,
+    // then next_round(first worker) is called on current thread and returns whether to run another round
+    // over shared.items; it may use the worker visitor for computation because no worker runs meanwhile
+    // results are left in shared in item order, so output does not depend on scheduling
+    template <class CodeWriter>
+    ebmgen::expected<void> render_toplevel_parallel(auto& visitor, ParallelToplevel<CodeWriter>& shared, size_t jobs,
+                                                    auto&& run_entry, auto&& render_items, auto&& next_round) {
+        using Visitor = std::remove_cvref_t<decltype(visitor)>;
+        using Impl = std::remove_cvref_t<decltype(visitor.impl)>;
+        using Output = std::remove_cvref_t<decltype(visitor.output)>;
+        // kept alive across rounds
+        struct Worker {
+            Impl impl;
+            Output output;
+            std::optional<Visitor> visitor;
+        };
+        std::vector<std::pmr::memory_resource*> resources;
+        std::vector<std::unique_ptr<Worker>> workers;
+        for (size_t i = 0; i < jobs; i++) {
+            resources.push_back(GenerationArena::fork());
+            workers.push_back(std::make_unique<Worker>());
+        }
+        auto run = [&](auto&& task) -> ebmgen::expected<void> {
+            std::vector<std::optional<ebmgen::Error>> errors(jobs);
+            {
+                std::vector<std::jthread> threads;
+                for (size_t i = 0; i < jobs; i++) {
+                    threads.emplace_back([&, i] {
+                        // same resource on every round; rounds do not overlap
+                        auto arena_scope = GenerationArena::install(resources[i]);
+                        auto result = task(*workers[i]);
+                        if (!result) {
+                            errors[i] = std::move(result.error());
+                        }
+                    });
+                }
+            }
+            for (auto& err : errors) {
+                if (err) {
+                    return ebmgen::unexpect_error(std::move(*err));
+                }
+            }
+            return {};
+        };
+        MAYBE_VOID(initialized, run([&](Worker& state) {
+                       auto& worker = state.visitor.emplace(visitor.flags, state.output, visitor.wm.root.out(), visitor.module_.module(), state.impl);
+                       worker.parallel_toplevel = &shared;
+                       worker.auto_output_root = false;
+                       worker.module_.build_maps();
+                       // set by pre_visitor hook, which is not run on workers because it may modify module itself
+                       auto modifier = visitor.module_.get_identifier_modifier();
+                       worker.module_.set_identifier_modifier(std::move(modifier));
+                       return run_entry(worker);
+                   }));
+        while (true) {
+            MAYBE_VOID(rendered, run([&](Worker& state) {
+                           return render_items(*state.visitor);
+                       }));
+            MAYBE(more, next_round(*workers[0]->visitor));
+            if (!more) {
+                return {};
+            }
+            shared.next_item = 0;
+        }
+    }
+}  // namespace ebmcodegen::util
@@ -0,0 +1,336 @@
+/*license*/
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <helper/defer.h>
+#include "arena.hpp"
+
+namespace ebmcodegen::util {
+    struct RopePosition {
+        size_t line = 0;
+        size_t column = 0;
+    };
+
+    template <class Loc>
+    struct RopeLocEntry {
+        Loc loc;
+        RopePosition start;
+        RopePosition end;
+    };
+
+    // drop-in replacement of futils::code::LocWriter for generator results
+    // writing another writer only shares its segments (no copy), and indentation
+    // is applied when the whole tree is flattened by to_string()
+    // so composing nested blocks is linear in output size instead of copying
+    // the same bytes once per nesting level
+    // segments and location entries are allocated from current GenerationArena
+    template <class Loc>
+    struct RopeWriter {
+       private:
+        struct Node;
+        enum class SegmentKind {
+            text,
+            unformatted,
+            child,
+            loc_begin,
+            loc_end,
+        };
+
+        struct Segment {
+            SegmentKind kind;
+            size_t indent = 0;  // relative to owner node
+            std::pmr::string text;
+            std::shared_ptr<const Node> child;
+            size_t loc_index = 0;
+        };
+
+        struct Flattened {
+            std::string text;
+            std::vector<RopeLocEntry<Loc>> locs;
+        };
+
+        // size of flattened content, kept up to date on each write so that str_size() does not flatten
+        // indentation is applied to pieces at line start, so it is kept for both states on entry
+        struct Extent {
+            size_t bytes = 0;           // without indentation
+            size_t indent_levels = 0;   // relative to owner node
+            size_t indented_lines = 0;  // pieces indented by indent of owner node
+            bool line_start = false;    // state after content
+
+            void append(const Extent& other, size_t indent) {
+                bytes += other.bytes;
+                indent_levels += other.indent_levels + other.indented_lines * indent;
+                indented_lines += other.indented_lines;
+                line_start = other.line_start;
+            }
+        };
+
+        struct Node {
+            std::pmr::vector<Segment> segments;
+            std::pmr::vector<Loc> locs;
+            bool has_content = false;
+            Extent extent[2] = {{.line_start = false}, {.line_start = true}};  // indexed by line_start on entry
+        };
+
+        static Extent text_extent(std::string_view str, bool line_start) {
+            Extent e{.line_start = line_start};
+            while (!str.empty()) {
+                auto line_end = str.find('\n');
+                auto piece = str.substr(0, line_end);
+                if (!piece.empty()) {
+                    if (e.line_start) {
+                        e.indented_lines++;
+                        e.line_start = false;
+                    }
+                    e.bytes += piece.size();
+                }
+                if (line_end == std::string_view::npos) {
+                    break;
+                }
+                e.bytes++;
+                e.line_start = true;
+                str = str.substr(line_end + 1);
+            }
+            return e;
+        }
+
+        struct Flattener {
+            std::string_view indent_unit;
+            Flattened& out;
+            bool line_start = true;
+            RopePosition pos;
+
+            void text(std::string_view str, size_t level) {
+                while (!str.empty()) {
+                    auto line_end = str.find('\n');
+                    auto piece = str.substr(0, line_end);
+                    if (!piece.empty()) {
+                        if (line_start) {
+                            for (size_t i = 0; i < level; i++) {
+                                out.text.append(indent_unit);
+                            }
+                            pos.column += level * indent_unit.size();
+                            line_start = false;
+                        }
+                        out.text.append(piece);
+                        pos.column += piece.size();
+                    }
+                    if (line_end == std::string_view::npos) {
+                        break;
+                    }
+                    out.text.push_back('\n');
+                    pos.line++;
+                    pos.column = 0;
+                    line_start = true;
+                    str = str.substr(line_end + 1);
+                }
+            }
+
+            void unformatted(std::string_view str) {
+                out.text.append(str);
+                for (auto c : str) {
+                    if (c == '\n') {
+                        pos.line++;
+                        pos.column = 0;
+                    }
+                    else {
+                        pos.column++;
+                    }
+                }
+                if (!str.empty()) {
+                    line_start = str.back() == '\n';
+                }
+            }
+
+            void node(const Node& n, size_t base) {
+                std::vector<size_t> loc_slots(n.locs.size());
+                for (auto& seg : n.segments) {
+                    switch (seg.kind) {
+                        case SegmentKind::text:
+                            text(seg.text, base + seg.indent);
+                            break;
+                        case SegmentKind::unformatted:
+                            unformatted(seg.text);
+                            break;
+                        case SegmentKind::child:
+                            node(*seg.child, base + seg.indent);
+                            break;
+                        case SegmentKind::loc_begin:
+                            loc_slots[seg.loc_index] = out.locs.size();
+                            out.locs.push_back(RopeLocEntry<Loc>{.loc = n.locs[seg.loc_index], .start = pos, .end = pos});
+                            break;
+                        case SegmentKind::loc_end:
+                            out.locs[loc_slots[seg.loc_index]].end = pos;
+                            break;
+                    }
+                }
+            }
+        };
+
+        std::shared_ptr<Node> node_;
+        size_t indent_ = 0;
+        static constexpr std::string_view indent_unit = "    ";
+
+        static std::shared_ptr<Node> new_node() {
+            std::pmr::polymorphic_allocator<Node> alloc{GenerationArena::resource()};
+            return std::allocate_shared<Node>(alloc, Node{
+                                                         .segments = std::pmr::vector<Segment>(alloc),
+                                                         .locs = std::pmr::vector<Loc>(alloc),
+                                                     });
+        }
+
+        // copy on write; segments may be shared by other writers
+        Node& mutable_node() {
+            if (!node_) {
+                node_ = new_node();
+            }
+            else if (node_.use_count() > 1) {
+                auto copy = new_node();
+                auto alloc = copy->segments.get_allocator();
+                copy->segments.reserve(node_->segments.size());
+                for (auto& seg : node_->segments) {
+                    copy->segments.push_back(Segment{seg.kind, seg.indent, std::pmr::string(seg.text, alloc), seg.child, seg.loc_index});
+                }
+                copy->locs.assign(node_->locs.begin(), node_->locs.end());
+                copy->has_content = node_->has_content;
+                copy->extent[0] = node_->extent[0];
+                copy->extent[1] = node_->extent[1];
+                node_ = std::move(copy);
+            }
+            return *node_;
+        }
+
+        void append_text(std::string_view str, SegmentKind kind) {
+            if (str.empty()) {
+                return;
+            }
+            auto& n = mutable_node();
+            n.has_content = true;
+            for (auto& e : n.extent) {
+                if (kind == SegmentKind::text) {
+                    e.append(text_extent(str, e.line_start), indent_);
+                }
+                else {
+                    e.bytes += str.size();
+                    e.line_start = str.back() == '\n';
+                }
+            }
+            if (!n.segments.empty() && n.segments.back().kind == kind && n.segments.back().indent == indent_) {
+                n.segments.back().text.append(str);
+                return;
+            }
+            n.segments.push_back(Segment{.kind = kind, .indent = indent_, .text = std::pmr::string(str, n.segments.get_allocator())});
+        }
+
+        void append_child(const RopeWriter& other) {
+            if (other.empty()) {
+                return;
+            }
+            auto& n = mutable_node();
+            n.has_content = true;
+            for (auto& e : n.extent) {
+                e.append(other.node_->extent[e.line_start], indent_);
+            }
+            n.segments.push_back(Segment{.kind = SegmentKind::child, .indent = indent_, .child = other.node_});
+        }
+
+        void write_one(auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_base_of_v<RopeWriter, T>) {
+                append_child(arg);
+            }
+            else if constexpr (std::is_same_v<T, char>) {
+                append_text(std::string_view(&arg, 1), SegmentKind::text);
+            }
+            else {
+                append_text(std::string_view(arg), SegmentKind::text);
+            }
+        }
+
+        // not cached; caching on each node would hold a copy of text per nesting level
+        Flattened flatten() const {
+            Flattened result;
+            if (node_) {
+                result.text.reserve(str_size());
+                Flattener f{.indent_unit = indent_unit, .out = result};
+                f.node(*node_, 0);
+            }
+            return result;
+        }
+
+       public:
+        void write(auto&&... args) {
+            (write_one(std::forward<decltype(args)>(args)), ...);
+        }
+
+        void writeln(auto&&... args) {
+            write(std::forward<decltype(args)>(args)...);
+            append_text("\n", SegmentKind::text);
+        }
+
+        void write_unformatted(std::string_view str) {
+            append_text(str, SegmentKind::unformatted);
+        }
+
+        void merge(RopeWriter&& other) {
+            append_child(other);
+        }
+
+        [[nodiscard]] auto indent_scope() {
+            indent_++;
+            return futils::helper::defer([this] {
+                indent_--;
+            });
+        }
+
+        void indent_writeln(auto&&... args) {
+            auto scope = indent_scope();
+            writeln(std::forward<decltype(args)>(args)...);
+        }
+
+        [[nodiscard]] auto with_loc_scope(Loc loc) {
+            auto& n = mutable_node();
+            auto index = n.locs.size();
+            n.locs.push_back(std::move(loc));
+            n.segments.push_back(Segment{.kind = SegmentKind::loc_begin, .loc_index = index});
+            return futils::helper::defer([this, index] {
+                mutable_node().segments.push_back(Segment{.kind = SegmentKind::loc_end, .loc_index = index});
+            });
+        }
+
+        void write_with_loc(Loc loc, auto&&... args) {
+            auto scope = with_loc_scope(std::move(loc));
+            write(std::forward<decltype(args)>(args)...);
+        }
+
+        void writeln_with_loc(Loc loc, auto&&... args) {
+            auto scope = with_loc_scope(std::move(loc));
+            writeln(std::forward<decltype(args)>(args)...);
+        }
+
+        bool empty() const {
+            return !node_ || !node_->has_content;
+        }
+
+        // flattens whole tree on each call
+        std::string to_string() const {
+            return flatten().text;
+        }
+
+        size_t str_size() const {
+            if (!node_) {
+                return 0;
+            }
+            auto& e = node_->extent[true];
+            return e.bytes + e.indent_levels * indent_unit.size();
+        }
+
+        std::vector<RopeLocEntry<Loc>> locs_data() const {
+            return flatten().locs;
+        }
+    };
+}  // namespace ebmcodegen::util
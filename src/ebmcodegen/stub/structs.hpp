@@ -45,4 +45,6 @@ namespace ebmcodegen {
     using CodeWriter = futils::code::CodeWriter<std::string>;
     std::string write_convert_from_json(const Struct& s);
     std::string write_convert_from_json(const Enum& e);
+    std::string write_convert_from_json_stream(const Struct& s);
+    std::string write_convert_from_json_stream(const Enum& e);
 }  // namespace ebmcodegen
@@ -342,6 +342,72 @@ namespace ebmcodegen::util {
         return std::nullopt;
     }
 
+    // find lowered statement of lowering type
+    // alternatives of MULTI_REPRESENTATION are also searched
+    std::optional<ebm::LoweredIOStatement> find_lowered_io(auto&& visitor, const ebm::IOData& io_data, ebm::LoweringIOType lowering_type) {
+        auto low = io_data.lowered_statement();
+        if (!low) {
+            return std::nullopt;
+        }
+        if (low->lowering_type == lowering_type) {
+            return *low;
+        }
+        if (low->lowering_type != ebm::LoweringIOType::MULTI_REPRESENTATION) {
+            return std::nullopt;
+        }
+        const ebmgen::MappingTable& module_ = get_visitor(visitor).module_;
+        auto stmt = module_.get_statement(low->io_statement.id);
+        if (!stmt) {
+            return std::nullopt;
+        }
+        auto lows = stmt->body.lowered_io_statements();
+        if (!lows) {
+            return std::nullopt;
+        }
+        for (auto& l : lows->container) {
+            if (l.lowering_type == lowering_type) {
+                return l;
+            }
+        }
+        return std::nullopt;
+    }
+
+    struct BulkPrimitiveArray {
+        const ebm::IOData* io_data = nullptr;  // element endian is in attribute
+        ebm::TypeKind element_kind = ebm::TypeKind::UINT;
+        size_t element_size = 0;  // in bits
+    };
+
+    // BULK_PRIMITIVE_ARRAY alternative of io_data if exists
+    std::optional<BulkPrimitiveArray> get_bulk_primitive_array(auto&& visitor, const ebm::IOData& io_data) {
+        auto low = find_lowered_io(visitor, io_data, ebm::LoweringIOType::BULK_PRIMITIVE_ARRAY);
+        if (!low) {
+            return std::nullopt;
+        }
+        const ebmgen::MappingTable& module_ = get_visitor(visitor).module_;
+        auto stmt = module_.get_statement(low->io_statement.id);
+        if (!stmt) {
+            return std::nullopt;
+        }
+        auto desc = stmt->body.read_data() ? stmt->body.read_data() : stmt->body.write_data();
+        if (!desc) {
+            return std::nullopt;
+        }
+        auto type = module_.get_type(desc->data_type);
+        if (!type || !type->body.element_type()) {
+            return std::nullopt;
+        }
+        auto elem_type = module_.get_type(*type->body.element_type());
+        if (!elem_type || !elem_type->body.size()) {
+            return std::nullopt;
+        }
+        return BulkPrimitiveArray{
+            .io_data = desc,
+            .element_kind = elem_type->body.kind,
+            .element_size = elem_type->body.size()->value(),
+        };
+    }
+
     ebmgen::expected<std::string> get_default_value(auto&& visitor, ebm::TypeRef ref, const DefaultValueOption& option = {}) {
         const ebmgen::MappingTable& module_ = get_visitor(visitor).module_;
         MAYBE(type, module_.get_type(ref));
@@ -518,7 +584,8 @@ namespace ebmcodegen::util {
         return result;
     }
 
-    void convert_location_info(auto&& ctx, auto&& loc_writer) {
+    // line_offset is line number of first line of loc_writer in output (for streamed chunks)
+    void convert_location_info(auto&& ctx, auto&& loc_writer, size_t line_offset = 0) {
         auto& visitor = get_visitor(ctx);
         auto& m = visitor.module_;
         for (auto& loc : loc_writer.locs_data()) {
@@ -537,7 +604,7 @@ namespace ebmcodegen::util {
                     .line = static_cast<size_t>(l->line.value()),
                     .col = static_cast<size_t>(l->column.value()),
                 },
-                .line = loc.start.line,
+                .line = loc.start.line + line_offset,
             });
         }
     }
@@ -586,12 +653,14 @@ namespace ebmcodegen::util {
         return ebmgen::unexpect_error("enum type has no members");
     }
 
-    void modify_keyword_identifier(ebm::ExtendedBinaryModule& m, std::unordered_set<std::string_view> keyword_list, auto&& change_rule) {
-        for (auto& ident : m.identifiers) {
-            if (keyword_list.contains(ident.body.data)) {
-                ident.body.data = change_rule(ident.body.data);
+    // rename identifiers which are keywords when they are looked up, instead of rewriting module
+    // so that module can be shared with other generators (ebmcodegen-multi)
+    void modify_keyword_identifier(ebmgen::MappingTable& m, std::unordered_set<std::string_view> keyword_list, auto&& change_rule) {
+        m.set_identifier_modifier([keyword_list = std::move(keyword_list), change_rule](ebm::StatementRef, std::string& name) {
+            if (keyword_list.contains(name)) {
+                name = change_rule(name);
             }
-        }
+        });
     }
 
     ebmgen::expected<size_t> get_variant_index(auto&& visitor, ebm::TypeRef variant_type, ebm::TypeRef candidate_type) {
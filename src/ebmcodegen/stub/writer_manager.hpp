@@ -4,6 +4,9 @@
 #include "binary/writer.h"
 #include "code/code_writer.h"
 #include "ebmgen/common.hpp"
+#include "ebmgen/mem_report.hpp"
+#include "parallel.hpp"
+#include <algorithm>
 #include <helper/defer.h>
 
 namespace ebmcodegen {
@@ -30,12 +33,35 @@ namespace ebmcodegen {
     struct WriterManager {
         futils::code::CodeWriter<futils::binary::writer&> root;
         std::vector<CodeWriter> tmp_writers;
+        // set if top-level declarations were written to root directly (--stream-output)
+        bool streamed = false;
+        size_t root_lines = 0;  // lines written by write_root
+        // collected only if track_memory is set (--mem-report)
+        bool track_memory = false;
+        ebmgen::WriterMemoryUsage memory_usage;
         [[nodiscard]] auto add_writer() {
             tmp_writers.emplace_back();
+            if (track_memory) {
+                memory_usage.tmp_max_depth = std::max(memory_usage.tmp_max_depth, tmp_writers.size());
+            }
             return futils::helper::defer([&]() {
+                if (track_memory) {
+                    auto size = tmp_writers.back().str_size();
+                    memory_usage.tmp_total_bytes += size;
+                    memory_usage.tmp_peak_bytes = std::max(memory_usage.tmp_peak_bytes, size);
+                }
                 tmp_writers.pop_back();
             });
         }
+        // write chunk to root and return line number of its first line
+        size_t write_root(const CodeWriter& chunk) {
+            auto str = chunk.to_string();
+            auto line = root_lines;
+            root_lines += std::ranges::count(str, '\n');
+            root.write_unformatted(str);
+            streamed = true;
+            return line;
+        }
         ebmgen::expected<WriterWrapper<CodeWriter>> get_writer() {
             if (tmp_writers.empty()) {
                 return ebmgen::unexpect_error("no available writer");
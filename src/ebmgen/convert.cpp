@@ -12,7 +12,7 @@ namespace ebmgen {
         }
         MAYBE_VOID(file_names, converter.repository().add_files(std::move(file_names)));
         TransformContext transform_ctx(converter);
-        MAYBE_VOID(t, transform(transform_ctx, opt.not_remove_unused, opt.timer_cb));
+        MAYBE_VOID(t, transform(transform_ctx, opt.not_remove_unused, opt.timer_cb, {.loop_invariant_code_motion = !opt.no_licm, .common_subexpression_elimination = !opt.no_cse}));
         MAYBE_VOID(f, converter.repository().finalize(ebm, opt.verify_uniqueness));
         if (opt.timer_cb) {
             opt.timer_cb("finalize");
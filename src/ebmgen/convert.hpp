@@ -10,6 +10,8 @@ namespace ebmgen {
     struct Option {
         bool not_remove_unused = false;  // for debug transformation
         bool verify_uniqueness = false;  // verify uniqueness of identifiers
+        bool no_licm = false;            // disable loop invariant code motion
+        bool no_cse = false;             // disable common subexpression elimination
         std::function<void(const char*)> timer_cb;
     };
 
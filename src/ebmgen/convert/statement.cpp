@@ -715,6 +715,11 @@ namespace ebmgen {
                                              state_vars);
         const auto _node = ctx.state().set_current_node(node);
         MAYBE(struct_decl, ctx.get_statement_converter().convert_struct_decl(name_ref, node->body->struct_type));
+        // size of custom encoded/decoded format is decided by its encode/decode function, not by fields
+        // (same as size of IOData in encode_struct_type/decode_struct_type)
+        if (node->encode_fn.lock() || node->decode_fn.lock()) {
+            struct_decl.is_fixed_size(false);
+        }
 
         auto handle = [&](ebm::StatementRef fn_ref, std::shared_ptr<ast::Function> fn, ebm::StatementRef coder_input, GenerateType typ) -> expected<void> {
             const auto _mode = ctx.state().set_current_generate_type(typ);
@@ -1,15 +1,18 @@
 #include "debug_printer.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <optional>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <type_traits>
 #include "ebm/extended_binary_module.hpp"
 #include "escape/escape.h"
 #include "helper/template_instance.h"
 #include "common.hpp"
+#include "parallel.hpp"
 #include "number/to_string.h"
 #include "unicode/utf/utf8.h"
 
@@ -20,6 +23,47 @@ namespace ebmgen {
         : module_(module), os_(os) {
     }
 
+    void DebugPrinter::set_threads(size_t threads) {
+        threads_ = resolve_thread_count(threads);
+    }
+
+    constexpr size_t debug_print_chunk_size = 1024;
+
+    // render(printer, index) for each index in [0, count)
+    // chunks are rendered into per-chunk buffers by worker threads and written in order
+    // at most threads_ * 2 chunks are held at once so memory is bounded
+    template <typename F>
+    void DebugPrinter::print_chunked(size_t count, F&& render) const {
+        const auto chunk_count = (count + debug_print_chunk_size - 1) / debug_print_chunk_size;
+        if (threads_ <= 1 || chunk_count <= 1) {
+            for (size_t i = 0; i < count; i++) {
+                render(*this, i);
+            }
+            return;
+        }
+        const auto wave_size = threads_ * 2;
+        std::vector<std::string> buffers(wave_size);
+        for (size_t wave = 0; wave < chunk_count; wave += wave_size) {
+            const auto chunks = std::min(wave_size, chunk_count - wave);
+            run_parallel(chunks, std::min(threads_, chunks), [&](size_t c, size_t) {
+                std::ostringstream ss;
+                DebugPrinter printer(module_, ss);
+                printer.indent_level_ = indent_level_;
+                const auto begin = (wave + c) * debug_print_chunk_size;
+                const auto end = std::min(count, begin + debug_print_chunk_size);
+                for (size_t i = begin; i < end; i++) {
+                    render(printer, i);
+                }
+                buffers[c] = std::move(ss).str();
+            });
+            for (size_t c = 0; c < chunks; c++) {
+                os_ << buffers[c];
+                buffers[c].clear();
+                buffers[c].shrink_to_fit();
+            }
+        }
+    }
+
     void DebugPrinter::print_resolved_reference(const ebm::IdentifierRef& ref) const {
         const auto* ident = module_.get_identifier(ref);
         os_ << ebm::Identifier::visitor_name << " ";
@@ -176,10 +220,10 @@ namespace ebmgen {
             }
             os_ << "\n";
             indent_level_++;
-            for (const auto& elem : value) {
-                indent();
-                print_value(elem);
-            }
+            print_chunked(value.size(), [&](const DebugPrinter& p, size_t i) {
+                p.indent();
+                p.print_value(value[i]);
+            });
             indent_level_--;
         }
         else if constexpr (std::is_same_v<T, ebm::Varint>) {
@@ -238,25 +282,29 @@ namespace ebmgen {
         }
         os_ << "Inverse references:\n";
         indent_level_++;
-        for (std::uint64_t i = 1; i <= get_id(module_.module().max_id); ++i) {
-            print_any_ref(ebm::AnyRef{i});
-            auto found = module_.get_inverse_ref(ebm::AnyRef{i});
-            if (!found) {
-                os_ << ": (no references)\n";
-                continue;
-            }
-            os_ << ":\n";
-            indent_level_++;
-            for (const auto& ref : *found) {
-                indent();
-                print_any_ref(ref.ref);
-                os_ << " (from: " << ref.name;
-                if (ref.index) {
-                    os_ << "[" << *ref.index << "]";
-                }
-                os_ << ", hint: " << to_string(ref.hint) << ")\n";
+        print_chunked(get_id(module_.module().max_id), [&](const DebugPrinter& p, size_t i) {
+            p.print_inverse_ref(i + 1);
+        });
+        indent_level_--;
+    }
+
+    void DebugPrinter::print_inverse_ref(std::uint64_t id) const {
+        print_any_ref(ebm::AnyRef{id});
+        auto found = module_.get_inverse_ref(ebm::AnyRef{id});
+        if (!found) {
+            os_ << ": (no references)\n";
+            return;
+        }
+        os_ << ":\n";
+        indent_level_++;
+        for (const auto& ref : *found) {
+            indent();
+            print_any_ref(ref.ref);
+            os_ << " (from: " << ref.name;
+            if (ref.index) {
+                os_ << "[" << *ref.index << "]";
             }
-            indent_level_--;
+            os_ << ", hint: " << to_string(ref.hint) << ")\n";
         }
         indent_level_--;
     }
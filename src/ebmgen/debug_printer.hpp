@@ -1,19 +1,69 @@
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <ostream>
+#include <streambuf>
+#include <binary/writer.h>
 
 #include "ebm/extended_binary_module.hpp"
 #include "mapping.hpp"
 
 namespace ebmgen {
 
+    // std::streambuf adapter writing to futils::binary::writer in chunks
+    // so that large debug output is not held in memory as a whole
+    class WriterStreamBuf : public std::streambuf {
+       public:
+        explicit WriterStreamBuf(futils::binary::writer& w)
+            : w_(w) {
+            setp(buffer_.data(), buffer_.data() + buffer_.size());
+        }
+
+        ~WriterStreamBuf() override {
+            sync();
+        }
+
+       protected:
+        int_type overflow(int_type ch) override {
+            if (!flush_buffer()) {
+                return traits_type::eof();
+            }
+            if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+            }
+            return traits_type::not_eof(ch);
+        }
+
+        int sync() override {
+            return flush_buffer() ? 0 : -1;
+        }
+
+       private:
+        futils::binary::writer& w_;
+        std::array<char, 64 * 1024> buffer_;
+
+        bool flush_buffer() {
+            auto size = pptr() - pbase();
+            if (size == 0) {
+                return true;
+            }
+            setp(buffer_.data(), buffer_.data() + buffer_.size());
+            return w_.write(std::string_view(buffer_.data(), size));
+        }
+    };
+
     class DebugPrinter {
        public:
         DebugPrinter(const MappingTable& module, std::ostream& os);
 
         void print_module() const;
 
+        // render large object tables in parallel chunks (0 means hardware concurrency)
+        // output is identical to single-threaded rendering
+        void set_threads(size_t threads);
+
         void print_object(const ebm::Identifier& obj) const;
         void print_object(const ebm::StringLiteral& obj) const;
         void print_object(const ebm::Type& obj) const;
@@ -23,6 +73,12 @@ namespace ebmgen {
        private:
         std::ostream& os_;  // Reference to the output stream
         const MappingTable& module_;
+        size_t threads_ = 1;
+
+        template <typename F>
+        void print_chunked(size_t count, F&& render) const;
+
+        void print_inverse_ref(std::uint64_t id) const;
 
         void print_resolved_reference(const ebm::IdentifierRef& ref) const;
         void print_resolved_reference(const ebm::StringRef& ref) const;
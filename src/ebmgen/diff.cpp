@@ -0,0 +1,175 @@
+/*license*/
+#include "diff.hpp"
+#include "fingerprint.hpp"
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include "escape/escape.h"
+
+namespace ebmgen {
+
+    std::vector<ebm::AnyRef> table_refs(const MappingTable& table, ebm::AliasHint hint) {
+        std::vector<ebm::AnyRef> refs;
+        auto collect = [&](auto& objects) {
+            refs.reserve(objects.size());
+            for (auto& obj : objects) {
+                refs.push_back(to_any_ref(obj.id));
+            }
+        };
+        switch (hint) {
+            case ebm::AliasHint::IDENTIFIER:
+                collect(table.module().identifiers);
+                break;
+            case ebm::AliasHint::STRING:
+                collect(table.module().strings);
+                break;
+            case ebm::AliasHint::TYPE:
+                collect(table.module().types);
+                break;
+            case ebm::AliasHint::STATEMENT:
+                collect(table.module().statements);
+                break;
+            case ebm::AliasHint::EXPRESSION:
+                collect(table.module().expressions);
+                break;
+            default:
+                break;
+        }
+        return refs;
+    }
+
+    // pair objects having same key one by one in table order
+    // returns pairs of index of old and new
+    std::vector<std::pair<size_t, size_t>> match_by_key(const std::vector<std::uint64_t>& old_keys, const std::vector<bool>& old_done,
+                                                        const std::vector<std::uint64_t>& new_keys, const std::vector<bool>& new_done) {
+        std::unordered_map<std::uint64_t, std::pair<size_t, std::vector<size_t>>> candidates;
+        for (size_t i = 0; i < new_keys.size(); i++) {
+            if (!new_done[i] && new_keys[i]) {
+                candidates[new_keys[i]].second.push_back(i);
+            }
+        }
+        std::vector<std::pair<size_t, size_t>> matched;
+        for (size_t i = 0; i < old_keys.size(); i++) {
+            if (old_done[i] || !old_keys[i]) {
+                continue;
+            }
+            auto found = candidates.find(old_keys[i]);
+            if (found == candidates.end()) {
+                continue;
+            }
+            auto& [next, list] = found->second;
+            if (next < list.size()) {
+                matched.emplace_back(i, list[next++]);
+            }
+        }
+        return matched;
+    }
+
+    // kind and identifier name of named statement, 0 if unnamed
+    std::uint64_t statement_name_key(const MappingTable& table, ebm::AnyRef ref) {
+        auto stmt_ref = from_any_ref<ebm::StatementRef>(ref);
+        auto stmt = table.get_statement(stmt_ref);
+        auto ident = table.get_identifier(stmt_ref);
+        if (!stmt || !ident) {
+            return 0;
+        }
+        return hash_mix(hash_mix(std::uint64_t(ebm::AliasHint::STATEMENT), std::uint64_t(stmt->body.kind)), hash_string(ident->body.data));
+    }
+
+    ModuleDiff diff_module(const MappingTable& old_table, const MappingTable& new_table) {
+        ModuleDiff diff;
+        for (auto hint : {ebm::AliasHint::IDENTIFIER, ebm::AliasHint::STRING, ebm::AliasHint::TYPE, ebm::AliasHint::STATEMENT, ebm::AliasHint::EXPRESSION}) {
+            auto old_refs = table_refs(old_table, hint);
+            auto new_refs = table_refs(new_table, hint);
+            std::vector<std::uint64_t> old_keys, new_keys;
+            for (auto& ref : old_refs) {
+                old_keys.push_back(old_table.fingerprint(ref));
+            }
+            for (auto& ref : new_refs) {
+                new_keys.push_back(new_table.fingerprint(ref));
+            }
+            std::vector<bool> old_done(old_refs.size()), new_done(new_refs.size());
+            auto& summary = diff.summary[hint];
+            for (auto [o, n] : match_by_key(old_keys, old_done, new_keys, new_done)) {
+                old_done[o] = new_done[n] = true;
+                summary.unchanged++;
+            }
+            if (hint == ebm::AliasHint::STATEMENT) {
+                for (size_t i = 0; i < old_refs.size(); i++) {
+                    old_keys[i] = statement_name_key(old_table, old_refs[i]);
+                }
+                for (size_t i = 0; i < new_refs.size(); i++) {
+                    new_keys[i] = statement_name_key(new_table, new_refs[i]);
+                }
+                for (auto [o, n] : match_by_key(old_keys, old_done, new_keys, new_done)) {
+                    old_done[o] = new_done[n] = true;
+                    summary.changed++;
+                    diff.entries.push_back({DiffKind::CHANGED, hint, old_refs[o], new_refs[n]});
+                }
+            }
+            for (size_t i = 0; i < old_refs.size(); i++) {
+                if (!old_done[i]) {
+                    summary.removed++;
+                    diff.entries.push_back({DiffKind::REMOVED, hint, old_refs[i], {}});
+                }
+            }
+            for (size_t i = 0; i < new_refs.size(); i++) {
+                if (!new_done[i]) {
+                    summary.added++;
+                    diff.entries.push_back({DiffKind::ADDED, hint, {}, new_refs[i]});
+                }
+            }
+        }
+        return diff;
+    }
+
+    std::string describe_object(const MappingTable& table, ebm::AnyRef ref) {
+        return std::visit(
+            [&](auto&& obj) -> std::string {
+                using T = std::decay_t<decltype(obj)>;
+                if constexpr (std::is_same_v<T, std::monostate>) {
+                    return "(unknown)";
+                }
+                else {
+                    using O = std::remove_cvref_t<decltype(*obj)>;
+                    if constexpr (std::is_same_v<O, ebm::Identifier> || std::is_same_v<O, ebm::StringLiteral>) {
+                        return "\"" + futils::escape::escape_str<std::string>(obj->body.data, futils::escape::EscapeFlag::all) + "\"";
+                    }
+                    else {
+                        std::string desc = to_string(obj->body.kind);
+                        if constexpr (std::is_same_v<O, ebm::Statement>) {
+                            if (auto ident = table.get_identifier(obj->id)) {
+                                desc += " ";
+                                desc += ident->body.data;
+                            }
+                        }
+                        return desc;
+                    }
+                }
+            },
+            table.get_object(ref));
+    }
+
+    void print_diff(std::ostream& os, const ModuleDiff& diff, const MappingTable& old_table, const MappingTable& new_table) {
+        for (auto& entry : diff.entries) {
+            switch (entry.kind) {
+                case DiffKind::CHANGED:
+                    os << "~ " << to_string(entry.table) << " " << describe_object(new_table, entry.new_ref)
+                       << " (" << get_id(entry.old_ref) << " -> " << get_id(entry.new_ref) << ")\n";
+                    break;
+                case DiffKind::REMOVED:
+                    os << "- " << to_string(entry.table) << " " << describe_object(old_table, entry.old_ref)
+                       << " (" << get_id(entry.old_ref) << ")\n";
+                    break;
+                case DiffKind::ADDED:
+                    os << "+ " << to_string(entry.table) << " " << describe_object(new_table, entry.new_ref)
+                       << " (" << get_id(entry.new_ref) << ")\n";
+                    break;
+            }
+        }
+        for (auto& [hint, summary] : diff.summary) {
+            os << to_string(hint) << ": " << summary.unchanged << " unchanged, " << summary.changed << " changed, "
+               << summary.added << " added, " << summary.removed << " removed\n";
+        }
+    }
+}  // namespace ebmgen
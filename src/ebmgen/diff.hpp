@@ -0,0 +1,45 @@
+/*license*/
+#pragma once
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <vector>
+#include "mapping.hpp"
+
+namespace ebmgen {
+    enum class DiffKind {
+        ADDED,
+        REMOVED,
+        CHANGED,
+    };
+
+    struct DiffEntry {
+        DiffKind kind;
+        ebm::AliasHint table;
+        ebm::AnyRef old_ref;  // nil if added
+        ebm::AnyRef new_ref;  // nil if removed
+    };
+
+    struct DiffSummary {
+        size_t unchanged = 0;
+        size_t changed = 0;
+        size_t added = 0;
+        size_t removed = 0;
+    };
+
+    struct ModuleDiff {
+        std::vector<DiffEntry> entries;
+        std::map<ebm::AliasHint, DiffSummary> summary;
+
+        bool empty() const {
+            return entries.empty();
+        }
+    };
+
+    // align two modules structurally without relying on object ids
+    // objects are first matched by MappingTable::fingerprint
+    // then remaining statements are matched by kind and identifier name and reported as changed
+    ModuleDiff diff_module(const MappingTable& old_table, const MappingTable& new_table);
+
+    void print_diff(std::ostream& os, const ModuleDiff& diff, const MappingTable& old_table, const MappingTable& new_table);
+}  // namespace ebmgen
@@ -0,0 +1,193 @@
+/*license*/
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <unordered_set>
+#include "fingerprint.hpp"
+#include "helper/template_instance.h"
+#include "mapping.hpp"
+
+namespace ebmgen {
+
+    // hash of object body where each reference is replaced by hash of referenced object
+    // so that it does not depend on concrete id values
+    // reference to an object still being hashed (reference cycle) is replaced by its distance on traversal stack,
+    // so that hash of cycle depends only on its shape and not on table order or where traversal entered it
+    struct StructuralHasher {
+        static constexpr std::uint64_t back_reference_seed = 2;
+        const MappingTable& table;
+        std::unordered_map<std::uint64_t, std::uint64_t>& memo;
+        // objects whose hash does not refer to themselves or objects above them on traversal stack
+        // only hash of these is reused from memo; others are hashed again each time they are reached
+        std::unordered_set<std::uint64_t> closed;
+        std::unordered_map<std::uint64_t, size_t> depth;  // objects being hashed and their position on traversal stack
+        size_t low = SIZE_MAX;                            // shallowest stack position referred while hashing current object
+
+        // kind and name only; used for back references (WeakStatementRef)
+        std::uint64_t shallow(ebm::StatementRef ref) {
+            auto stmt = table.get_statement(ref);
+            if (!stmt) {
+                return 0;
+            }
+            auto h = hash_mix(std::uint64_t(ebm::AliasHint::STATEMENT), std::uint64_t(stmt->body.kind));
+            if (auto ident = table.get_identifier(ref)) {
+                h = hash_mix(h, hash_string(ident->body.data));
+            }
+            return h;
+        }
+
+        std::uint64_t of(ebm::AnyRef ref) {
+            if (is_nil(ref)) {
+                return 0;
+            }
+            const auto id = get_id(ref);
+            if (closed.contains(id)) {
+                return memo[id];
+            }
+            if (auto found = depth.find(id); found != depth.end()) {
+                low = std::min(low, found->second);
+                return hash_mix(back_reference_seed, depth.size() - found->second);
+            }
+            return std::visit(
+                [&](auto&& obj) -> std::uint64_t {
+                    using T = std::decay_t<decltype(obj)>;
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        return 1;  // dangling reference
+                    }
+                    else {
+                        using O = std::remove_cvref_t<decltype(*obj)>;
+                        std::uint64_t seed = 0;
+                        if constexpr (std::is_same_v<O, ebm::Identifier>) {
+                            seed = std::uint64_t(ebm::AliasHint::IDENTIFIER);
+                        }
+                        else if constexpr (std::is_same_v<O, ebm::StringLiteral>) {
+                            seed = std::uint64_t(ebm::AliasHint::STRING);
+                        }
+                        else if constexpr (std::is_same_v<O, ebm::Type>) {
+                            seed = std::uint64_t(ebm::AliasHint::TYPE);
+                        }
+                        else if constexpr (std::is_same_v<O, ebm::Expression>) {
+                            seed = std::uint64_t(ebm::AliasHint::EXPRESSION);
+                        }
+                        else {
+                            seed = std::uint64_t(ebm::AliasHint::STATEMENT);
+                        }
+                        const auto d = depth.size();
+                        depth.emplace(id, d);
+                        const auto parent_low = std::exchange(low, SIZE_MAX);
+                        auto h = value(seed, obj->body);
+                        depth.erase(id);
+                        // not on any cycle; same wherever it is reached
+                        // (object on cycle would be hashed differently from each entry point of cycle)
+                        if (low > d) {
+                            closed.insert(id);
+                            memo[id] = h;
+                        }
+                        else if (d == 0) {
+                            memo[id] = h;  // root; hashed from itself
+                        }
+                        low = std::min(parent_low, low);
+                        return h;
+                    }
+                },
+                table.get_object(ref));
+        }
+
+        template <typename T>
+        std::uint64_t value(std::uint64_t h, const T& v) {
+            if constexpr (std::is_enum_v<T>) {
+                return hash_mix(h, std::uint64_t(v));
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                return hash_mix(h, v ? 1 : 0);
+            }
+            else if constexpr (futils::helper::is_template_instance_of<T, std::vector>) {
+                h = hash_mix(h, v.size());
+                for (const auto& elem : v) {
+                    h = value(h, elem);
+                }
+                return h;
+            }
+            else if constexpr (std::is_same_v<T, ebm::Varint>) {
+                return hash_mix(h, v.value());
+            }
+            else if constexpr (AnyRef<T>) {
+                return hash_mix(h, of(to_any_ref(v)));
+            }
+            else if constexpr (WeakAnyRef<T>) {
+                return hash_mix(h, is_nil(v) ? 0 : shallow(from_weak(v)));
+            }
+            else if constexpr (has_visit<T, DummyFn>) {
+                v.visit([&](auto&&, const char*, auto&& field) {
+                    h = field_value(h, field);
+                });
+                return h;
+            }
+            else if constexpr (std::is_integral_v<T>) {
+                return hash_mix(h, std::uint64_t(v));
+            }
+            else if constexpr (std::is_same_v<T, std::string>) {
+                return hash_mix(h, hash_string(v));
+            }
+            else {
+                static_assert(std::is_same_v<T, void>, "unexpected");
+            }
+        }
+
+        template <typename T>
+        std::uint64_t field_value(std::uint64_t h, const T& v) {
+            return value(h, v);
+        }
+
+        template <typename T>
+        std::uint64_t field_value(std::uint64_t h, const T* v) {
+            if (!v) {
+                return hash_mix(h, 0);
+            }
+            if constexpr (std::is_same_v<T, char>) {
+                return hash_mix(hash_mix(h, 1), hash_string(v));
+            }
+            else {
+                return value(hash_mix(h, 1), *v);
+            }
+        }
+    };
+
+    std::uint64_t MappingTable::fingerprint(const ebm::AnyRef& ref) const {
+        auto& objects = fingerprints().objects;
+        auto found = objects.find(get_id(ref));
+        return found == objects.end() ? 0 : found->second;
+    }
+
+    std::uint64_t MappingTable::module_fingerprint() const {
+        return fingerprints().module;
+    }
+
+    const MappingTable::Fingerprints& MappingTable::fingerprints() const {
+        if (fingerprints_) {
+            return *fingerprints_;
+        }
+        auto& result = fingerprints_.emplace();
+        StructuralHasher hasher{*this, result.objects};
+        // sum is commutative so that module fingerprint does not depend on table order
+        std::uint64_t sum = 0;
+        auto hash_all = [&](auto& objects) {
+            result.objects.reserve(result.objects.size() + objects.size());
+            for (auto& obj : objects) {
+                sum += hasher.of(to_any_ref(obj.id));
+            }
+        };
+        hash_all(module_.identifiers);
+        hash_all(module_.strings);
+        hash_all(module_.types);
+        hash_all(module_.expressions);
+        hash_all(module_.statements);
+        std::uint64_t entry = 0;
+        if (auto entry_point = get_entry_point()) {
+            entry = hasher.of(to_any_ref(entry_point->id));
+        }
+        result.module = hash_mix(entry, sum);
+        return result;
+    }
+}  // namespace ebmgen
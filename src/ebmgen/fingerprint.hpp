@@ -0,0 +1,25 @@
+/*license*/
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace ebmgen {
+    constexpr std::uint64_t hash_mix(std::uint64_t h, std::uint64_t v) {
+        h ^= v + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111eb;
+        h ^= h >> 31;
+        return h;
+    }
+
+    constexpr std::uint64_t hash_string(std::string_view s) {
+        std::uint64_t h = 0xcbf29ce484222325;  // FNV-1a
+        for (auto c : s) {
+            h ^= std::uint8_t(c);
+            h *= 0x100000001b3;
+        }
+        return h;
+    }
+}  // namespace ebmgen
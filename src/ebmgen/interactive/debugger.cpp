@@ -2,12 +2,17 @@
 #include <wrap/cin.h>
 #include <wrap/cout.h>
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <map>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <unordered_set>
 #include <variant>
@@ -22,9 +27,11 @@
 #include "ebmgen/common.hpp"
 #include "ebmgen/debug_printer.hpp"
 #include "ebmgen/mapping.hpp"
+#include "ebmgen/parallel.hpp"
 #include "error/error.h"
 #include "escape/escape.h"
 #include "number/hex/bin2hex.h"
+#include "number/parse.h"
 #include "number/prefix.h"
 #include <strutil/splits.h>
 #include <comb2/composite/cmdline.h>
@@ -104,29 +111,215 @@ namespace ebmgen {
 
     using ObjectSet = std::unordered_set<ebm::AnyRef>;
 
-    using EvalValue = std::variant<bool, std::uint64_t, std::string, ebm::AnyRef, ObjectSet>;
+    // value on evaluation stack
+    // strings are views of query constants or module objects, so that evaluation does not allocate
+    using EvalValue = std::variant<bool, std::uint64_t, std::string_view, ebm::AnyRef, const ObjectSet*>;
 
     using ObjectVariantExtended = std::variant<std::monostate, const ebm::Identifier*, const ebm::StringLiteral*, const ebm::Type*, const ebm::Statement*, const ebm::Expression*, const ebm::RefAlias*>;
+
+    // field path like `body.block[0]` split at compile time
+    // FieldNames in access.hpp requires compile time string, so that query uses runtime segments instead
+    // segments are views of text, which is shared so that FieldPath can be copied or moved
+    struct FieldPath {
+        struct Segment {
+            std::string_view name;
+            std::optional<size_t> index;
+        };
+        std::shared_ptr<const std::string> text;
+        std::vector<Segment> segments;
+
+        static FieldPath parse(std::string_view path) {
+            FieldPath result;
+            result.text = std::make_shared<const std::string>(path);
+            std::string_view rest = *result.text;
+            while (true) {
+                auto dot = rest.find('.');
+                auto seg = rest.substr(0, dot);
+                Segment segment;
+                auto bracket = seg.find('[');
+                size_t index = 0;
+                if (bracket != std::string_view::npos && seg.back() == ']' &&
+                    futils::number::parse_integer(seg.substr(bracket + 1, seg.size() - bracket - 2), index)) {
+                    segment.name = seg.substr(0, bracket);
+                    segment.index = index;
+                }
+                else {
+                    segment.name = seg;  // never matches if brackets are malformed
+                }
+                result.segments.push_back(segment);
+                if (dot == std::string_view::npos) {
+                    break;
+                }
+                rest = rest.substr(dot + 1);
+            }
+            return result;
+        }
+    };
+
+    // resolve field path by visiting only fields on the path
+    // returns false if path does not exist on the object or does not point to scalar value
+    static bool resolve_field(const FieldPath& path, const auto& root, EvalValue& out) {
+        size_t depth = 0;
+        bool done = false;
+        bool found = false;
+        auto set_leaf = [&](auto&& value) -> bool {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, ebm::Varint>) {
+                out = std::uint64_t(value.value());
+                return true;
+            }
+            else if constexpr (AnyRef<T>) {
+                out = to_any_ref(value);
+                return true;
+            }
+            else if constexpr (std::is_enum_v<T>) {
+                out = std::string_view(to_string(value, true));
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                out = value;
+                return true;
+            }
+            else if constexpr (std::is_integral_v<T>) {
+                out = std::uint64_t(value);
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, std::string>) {
+                out = std::string_view(value);
+                return true;
+            }
+            else {
+                return false;
+            }
+        };
+        auto descend = [&](auto&& visitor, auto&& value) {
+            if (depth + 1 == path.segments.size()) {
+                found = set_leaf(value);
+            }
+            else if constexpr (ebmgen::has_visit<decltype(value), decltype(visitor)>) {
+                depth++;
+                done = false;
+                value.visit(visitor);
+                done = true;
+            }
+        };
+        root.visit([&](auto&& visitor, const char* name, auto&& value) -> void {
+            if (done) {
+                return;
+            }
+            auto& seg = path.segments[depth];
+            if (seg.name != name) {
+                return;
+            }
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_pointer_v<T>) {
+                if (value) {
+                    visitor(visitor, name, *value);
+                }
+                else {
+                    done = true;  // not active union member
+                }
+            }
+            else if constexpr (is_container<decltype(value)>) {
+                done = true;
+                if (seg.index && *seg.index < value.container.size()) {
+                    descend(visitor, value.container[*seg.index]);
+                }
+            }
+            else {
+                done = true;
+                if (!seg.index) {
+                    descend(visitor, value);
+                }
+            }
+        });
+        return found;
+    }
+
+    struct Object;
+
+    enum class OpCode : std::uint8_t {
+        PushConst,      // constants[operand]
+        PushString,     // strings[operand]
+        LoadField,      // fields[operand] of current object
+        LoadMember,     // fields[operand] of object referred by top of stack
+        Compare,        // compare top two values with cmp
+        Not,            // logical not of top
+        Contains,       // current object has reference equal to top
+        JumpIfFalse,    // if top is false, keep it and jump to operand, otherwise pop
+        JumpIfTrue,     // if top is true, keep it and jump to operand, otherwise pop
+        PushObjectSet,  // result of subqueries[operand]
+    };
+
+    enum class CompareOp : std::uint8_t {
+        eq,
+        ne,
+        gt,
+        ge,
+        lt,
+        le,
+    };
+
+    struct Instruction {
+        OpCode op;
+        CompareOp cmp = CompareOp::eq;
+        std::uint32_t operand = 0;
+    };
+
+    struct SubqueryState {
+        bool evaluated = false;
+        ExecutionResult result = ExecutionResult::Success;
+        ObjectSet matched;
+    };
+
+    // per query call state, reused for each object
+    struct EvalState {
+        std::vector<EvalValue> stack;
+        std::vector<SubqueryState> subqueries;
+    };
+
+    // failures recorded while evaluating objects as bits of ExecutionResult, so that recording does not allocate
+    struct FailureMask {
+        std::uint32_t bits = 0;
+
+        void insert(ExecutionResult r) {
+            bits |= std::uint32_t(1) << static_cast<std::uint32_t>(r);
+        }
+
+        void insert(const Failures& failures) {
+            for (auto r : failures) {
+                insert(r);
+            }
+        }
+
+        void merge_to(Failures& failures) const {
+            for (std::uint32_t i = 0; i < 32; i++) {
+                if (bits & (std::uint32_t(1) << i)) {
+                    failures.insert(static_cast<ExecutionResult>(i));
+                }
+            }
+        }
+    };
+
     struct EvalContext {
         MappingTable& table;
-        Failures& failures;
-        std::vector<EvalValue> stack;
-        std::map<std::string, EvalValue> variables;
+        FailureMask& failures;
+        EvalState& state;
         ObjectVariantExtended current_target;
 
         template <class T>
         void unwrap_any_ref(EvalValue& value) {
             if (std::holds_alternative<ebm::AnyRef>(value)) {
                 auto ref = std::get<ebm::AnyRef>(value);
-                if constexpr (std::is_same_v<T, std::string>) {
+                if constexpr (std::is_same_v<T, std::string_view>) {
                     auto ident = table.get_identifier(ref);
                     if (ident) {
-                        value = ident->body.data;
+                        value = std::string_view(ident->body.data);
                     }
                     else {
                         auto str_lit = table.get_string_literal(ebm::StringRef{ref.id});
                         if (str_lit) {
-                            value = str_lit->body.data;
+                            value = std::string_view(str_lit->body.data);
                         }
                     }
                 }
@@ -139,140 +332,195 @@ namespace ebmgen {
             }
         }
     };
-    using EvalFunc = std::function<ExecutionResult(EvalContext&)>;
-    static void collect_variables(std::map<std::string, EvalValue>& variables, const std::unordered_set<std::string>& related_identifiers, has_visit<DummyFn> auto& t) {
-        std::vector<std::string> idents;
-        auto qualified_name = [&](const char* name) -> std::string {
-            if (idents.size()) {
-                return idents.back() + "." + name;
-            }
-            return name;
-        };
-        t.visit([&](auto&& visitor, const char* name, auto&& value) -> void {
-            using T = std::decay_t<decltype(value)>;
-            if constexpr (std::is_pointer_v<std::decay_t<decltype(value)>>) {
-                if (value) {
-                    visitor(visitor, name, *value);
+
+    // flat compiled form of object query
+    struct Program {
+        std::vector<Instruction> code;
+        std::vector<EvalValue> constants;  // except strings
+        std::vector<std::string> strings;
+        std::vector<FieldPath> fields;
+        std::vector<Object> subqueries;
+
+        ExecutionResult run(EvalContext& ctx) const;
+    };
+
+    // matches of contiguous range of table
+    struct ChunkResult {
+        std::vector<ebm::AnyRef> matched;  // in table order
+        FailureMask failures;
+        bool some_has_valid_result = false;
+        bool has_identifier_not_found = false;
+    };
+
+    constexpr size_t query_chunk_size = 4096;
+
+    // equality predicate that can be answered from index of MappingTable
+    struct IndexKey {
+        enum class Kind {
+            Id,              // id == <number>
+            KindName,        // body.kind == "<kind>"
+            IdentifierName,  // id == "<name>"
+        } kind;
+        std::uint64_t id = 0;
+        std::string value;
+    };
+
+    struct Object {
+        std::string type;
+        Program program;
+        std::vector<IndexKey> index_keys;  // combined with `and`, so every match satisfies all of them
+
+        // candidates of table narrowed by index_keys
+        // nullopt means table must be scanned
+        std::optional<std::vector<ebm::AnyRef>> plan(MappingTable& table, ebm::AliasHint hint) const {
+            std::optional<std::vector<ebm::AnyRef>> candidates;
+            for (auto& key : index_keys) {
+                const std::vector<ebm::AnyRef>* found = nullptr;
+                std::vector<ebm::AnyRef> single;
+                switch (key.kind) {
+                    case IndexKey::Kind::Id:
+                        if (hint != ebm::AliasHint::ALIAS) {
+                            if (table.get_object(ebm::AnyRef{key.id}).index() != 0) {
+                                single.push_back(ebm::AnyRef{key.id});
+                            }
+                            found = &single;
+                        }
+                        break;
+                    case IndexKey::Kind::KindName:
+                        found = table.find_by_kind(hint, key.value);
+                        break;
+                    case IndexKey::Kind::IdentifierName:
+                        found = table.find_by_identifier_name(hint, key.value);
+                        break;
                 }
-            }
-            else if constexpr (is_container<decltype(value)>) {
-                for (size_t i = 0; i < value.container.size(); i++) {
-                    std::string elem_name = std::format("{}[{}]", name, i);
-                    visitor(visitor, elem_name.c_str(), value.container[i]);
+                // other keys are checked by evaluator, so smallest one is enough
+                if (found && (!candidates || found->size() < candidates->size())) {
+                    candidates = *found;
                 }
             }
-            else {
-                auto qname = qualified_name(name);
-                if constexpr (std::is_same_v<T, ebm::Varint>) {
-                    if (related_identifiers.contains(qname)) {
-                        variables[qname] = value.value();
-                    }
-                }
-                else if constexpr (AnyRef<T>) {
-                    if (related_identifiers.contains(qname)) {
-                        variables[qname] = to_any_ref(value);
+            return candidates;
+        }
+
+        EvalState make_state() const {
+            EvalState state;
+            state.stack.reserve(program.code.size() + 1);
+            state.subqueries.resize(program.subqueries.size());
+            return state;
+        }
+
+        // threads > 1 splits large tables into chunks evaluated in parallel
+        // chunks are merged in table order, so that result is same as sequential evaluation
+        ExecutionResult query(MappingTable& table, ObjectSet& matched, Failures& failures, ObjectResult* result = nullptr, size_t threads = 1) const {
+            std::vector<ChunkResult> chunks;
+            EvalState main_state = make_state();
+            auto evaluate = [&](auto& t, EvalState& state, ChunkResult& chunk) {
+                EvalContext ctx{.table = table, .failures = chunk.failures, .state = state, .current_target = &t};
+                auto exec_result = program.run(ctx);
+                auto& stack = state.stack;
+                if (exec_result == ExecutionResult::Success && stack.size() == 1) {
+                    ctx.unwrap_any_ref<bool>(stack[0]);
+                    chunk.some_has_valid_result = true;
+                    if (std::holds_alternative<bool>(stack[0]) && std::get<bool>(stack[0])) {
+                        if constexpr (std::is_same_v<decltype(t), const ebm::RefAlias&>) {
+                            chunk.matched.push_back(to_any_ref(t.from));
+                        }
+                        else {
+                            chunk.matched.push_back(to_any_ref(t.id));
+                        }
                     }
                 }
-                else if constexpr (std::is_enum_v<T>) {
-                    if (related_identifiers.contains(qname)) {
-                        variables[qname] = to_string(value, true);
-                    }
+                else if (exec_result == ExecutionResult::IdentifierNotFound) {
+                    chunk.has_identifier_not_found = true;
                 }
-                else if constexpr (std::is_same_v<T, bool>) {
-                    if (related_identifiers.contains(qname)) {
-                        variables[qname] = value;
-                    }
+                else if (exec_result != ExecutionResult::Success) {
+                    chunk.failures.insert(exec_result);
                 }
-                else if constexpr (std::is_integral_v<T>) {
-                    if (related_identifiers.contains(qname)) {
-                        variables[qname] = std::uint64_t(value);
-                    }
+                else {
+                    chunk.failures.insert(ExecutionResult::InconsistentStack);
                 }
-                else if constexpr (std::is_same_v<T, std::string>) {
-                    if (related_identifiers.contains(qname)) {
-                        variables[qname] = value;
+            };
+            auto for_range = [&](size_t count, auto&& evaluate_at) {
+                if (threads <= 1 || count <= query_chunk_size) {
+                    // sequential ranges are appended to same chunk, which keeps table order
+                    auto& chunk = chunks.empty() ? chunks.emplace_back() : chunks.back();
+                    chunk.matched.reserve(chunk.matched.size() + std::min(count, query_chunk_size));
+                    for (size_t i = 0; i < count; i++) {
+                        evaluate_at(i, main_state, chunk);
                     }
+                    return;
                 }
-                else if constexpr (ebmgen::has_visit<decltype(value), decltype(visitor)>) {
-                    idents.push_back(std::move(qname));
-                    value.visit(visitor);
-                    idents.pop_back();
-                }
-                else {
-                    static_assert(std::is_same_v<T, void>, "unsupported type in query");
+                table.prepare_query_index();  // subqueries may use index in worker threads
+                const auto base = chunks.size();
+                const auto chunk_count = (count + query_chunk_size - 1) / query_chunk_size;
+                chunks.resize(base + chunk_count);
+                std::vector<EvalState> states;
+                for (size_t i = 0; i < std::min(threads, chunk_count); i++) {
+                    states.push_back(make_state());
                 }
-            }
-        });
-    }
-    struct Object {
-        std::string type;
-        std::unordered_set<std::string> related_identifiers;
-        EvalFunc evaluator;
-
-        ExecutionResult query(MappingTable& table, ObjectSet& matched, Failures& failures, ObjectResult* result = nullptr) const {
-            bool some_has_valid_result = false;
-            bool has_identifier_not_found = false;
-            auto for_each = [&](auto& objects) {
-                for (auto& t : objects) {
-                    EvalContext ctx{.table = table, .failures = failures, .current_target = &t};
-                    collect_variables(ctx.variables, related_identifiers, t);
-                    auto exec_result = evaluator(ctx);
-                    if (exec_result == ExecutionResult::Success && ctx.stack.size() == 1) {
-                        ctx.unwrap_any_ref<bool>(ctx.stack[0]);
-                        some_has_valid_result = true;
-                        if (std::holds_alternative<bool>(ctx.stack[0]) && std::get<bool>(ctx.stack[0])) {
-                            if constexpr (std::is_same_v<decltype(t), const ebm::RefAlias&>) {
-                                if (matched.insert(t.from).second && result) {
-                                    result->push_back(to_any_ref(t.from));
-                                }
-                            }
-                            else {
-                                if (matched.insert(to_any_ref(t.id)).second && result) {
-                                    result->push_back(to_any_ref(t.id));
-                                }
-                            }
-                        }
-                    }
-                    else if (exec_result == ExecutionResult::IdentifierNotFound) {
-                        has_identifier_not_found = true;
-                    }
-                    else if (exec_result != ExecutionResult::Success) {
-                        failures.insert(exec_result);
-                    }
-                    else {
-                        failures.insert(ExecutionResult::InconsistentStack);
+                run_parallel(chunk_count, states.size(), [&](size_t c, size_t worker) {
+                    const auto end = std::min(count, (c + 1) * query_chunk_size);
+                    chunks[base + c].matched.reserve(end - c * query_chunk_size);
+                    for (size_t i = c * query_chunk_size; i < end; i++) {
+                        evaluate_at(i, states[worker], chunks[base + c]);
                     }
+                });
+            };
+            auto for_each = [&](auto& objects, ebm::AliasHint hint) {
+                using T = std::decay_t<decltype(objects[0])>;
+                if (auto candidates = plan(table, hint)) {
+                    for_range(candidates->size(), [&](size_t i, EvalState& state, ChunkResult& chunk) {
+                        auto obj = table.get_object((*candidates)[i]);
+                        if (auto t = std::get_if<const T*>(&obj)) {
+                            evaluate(**t, state, chunk);
+                        }
+                    });
+                    return;
                 }
+                for_range(objects.size(), [&](size_t i, EvalState& state, ChunkResult& chunk) {
+                    evaluate(objects[i], state, chunk);
+                });
             };
             if (type == "Identifier") {
-                for_each(table.module().identifiers);
+                for_each(table.module().identifiers, ebm::AliasHint::IDENTIFIER);
             }
             else if (type == "String") {
-                for_each(table.module().strings);
+                for_each(table.module().strings, ebm::AliasHint::STRING);
             }
             else if (type == "Type") {
-                for_each(table.module().types);
+                for_each(table.module().types, ebm::AliasHint::TYPE);
             }
             else if (type == "Statement") {
-                for_each(table.module().statements);
+                for_each(table.module().statements, ebm::AliasHint::STATEMENT);
             }
             else if (type == "Expression") {
-                for_each(table.module().expressions);
+                for_each(table.module().expressions, ebm::AliasHint::EXPRESSION);
             }
             else if (type == "Alias") {
-                for_each(table.module().aliases);
+                for_each(table.module().aliases, ebm::AliasHint::ALIAS);
             }
             else if (type == "Any") {
-                for_each(table.module().identifiers);
-                for_each(table.module().strings);
-                for_each(table.module().types);
-                for_each(table.module().statements);
-                for_each(table.module().expressions);
+                for_each(table.module().identifiers, ebm::AliasHint::IDENTIFIER);
+                for_each(table.module().strings, ebm::AliasHint::STRING);
+                for_each(table.module().types, ebm::AliasHint::TYPE);
+                for_each(table.module().statements, ebm::AliasHint::STATEMENT);
+                for_each(table.module().expressions, ebm::AliasHint::EXPRESSION);
             }
             else {
                 failures.insert(ExecutionResult::InvalidOperator);
                 return ExecutionResult::InvalidOperator;
             }
+            bool some_has_valid_result = false;
+            bool has_identifier_not_found = false;
+            for (auto& chunk : chunks) {
+                for (auto& ref : chunk.matched) {
+                    if (matched.insert(ref).second && result) {
+                        result->push_back(ref);
+                    }
+                }
+                chunk.failures.merge_to(failures);
+                some_has_valid_result |= chunk.some_has_valid_result;
+                has_identifier_not_found |= chunk.has_identifier_not_found;
+            }
             if (!some_has_valid_result && has_identifier_not_found) {
                 failures.insert(ExecutionResult::IdentifierNotFound);
                 return ExecutionResult::IdentifierNotFound;
@@ -284,18 +532,18 @@ namespace ebmgen {
     struct Query {
         std::vector<Object> objects;
 
-        void query(MappingTable& table, ObjectSet& matched, Failures& failures, ObjectResult* result = nullptr) const {
+        void query(MappingTable& table, ObjectSet& matched, Failures& failures, ObjectResult* result = nullptr, size_t threads = 1) const {
             for (const auto& obj : objects) {
-                obj.query(table, matched, failures, result);
+                obj.query(table, matched, failures, result, threads);
             }
         }
     };
 #define CHECK_AND_TAKE(var)                 \
-    if (ctx.stack.empty()) {                \
+    if (ctx.state.stack.empty()) {          \
         return ExecutionResult::StackEmpty; \
     }                                       \
-    auto var = std::move(ctx.stack.back()); \
-    ctx.stack.pop_back()
+    auto var = ctx.state.stack.back();      \
+    ctx.state.stack.pop_back()
 
 #define CHECK_AND_TAKE_AS(var, T)              \
     CHECK_AND_TAKE(var##__);                   \
@@ -308,154 +556,273 @@ namespace ebmgen {
     using NodeType = query::NodeType;
     using Node = query::Node;
 
-#define RETURN_EXEC_FAILURE(expr)                                 \
-    do {                                                          \
-        if (auto res = (expr); res != ExecutionResult::Success) { \
-            return res;                                           \
-        }                                                         \
-    } while (0)
+    static void adjust_operands(EvalContext& ctx, EvalValue& left_value, EvalValue& right_value) {
+        auto adjust_any_ref = [&](EvalValue& any_ref, EvalValue& adjust_to) {
+            if (std::holds_alternative<std::string_view>(adjust_to)) {
+                ctx.unwrap_any_ref<std::string_view>(any_ref);
+            }
+            else if (std::holds_alternative<std::uint64_t>(adjust_to)) {
+                ctx.unwrap_any_ref<std::uint64_t>(any_ref);
+            }
+            else if (std::holds_alternative<bool>(adjust_to)) {
+                ctx.unwrap_any_ref<bool>(any_ref);
+            }
+        };
+        if (std::holds_alternative<ebm::AnyRef>(left_value) && !std::holds_alternative<ebm::AnyRef>(right_value)) {
+            adjust_any_ref(left_value, right_value);
+        }
+        else if (std::holds_alternative<ebm::AnyRef>(right_value) && !std::holds_alternative<ebm::AnyRef>(left_value)) {
+            adjust_any_ref(right_value, left_value);
+        }
+    }
 
-    struct QueryCompiler {
-        MappingTable& table;
-        ExecutionResult query_short_circuit(EvalContext& ctx, const EvalFunc& left, const EvalFunc& right, bool short_circuit) {
-            RETURN_EXEC_FAILURE(left(ctx));
-            CHECK_AND_TAKE_AS(left_value, bool);
-            if (left_value == short_circuit) {
-                ctx.stack.push_back(EvalValue{left_value});
-                return ExecutionResult::Success;
+    static ExecutionResult compare_values(CompareOp op, const EvalValue& left_value, const EvalValue& right_value, bool& result) {
+        auto equality = [&](auto l, auto r) {
+            if (op == CompareOp::eq) {
+                result = (l == r);
+            }
+            else if (op == CompareOp::ne) {
+                result = (l != r);
+            }
+            else {
+                return ExecutionResult::InvalidOperator;
             }
-            return right(ctx);
+            return ExecutionResult::Success;
+        };
+        if (std::holds_alternative<bool>(left_value) && std::holds_alternative<bool>(right_value)) {
+            return equality(std::get<bool>(left_value), std::get<bool>(right_value));
         }
+        else if (std::holds_alternative<std::string_view>(left_value) && std::holds_alternative<std::string_view>(right_value)) {
+            return equality(std::get<std::string_view>(left_value), std::get<std::string_view>(right_value));
+        }
+        else if (std::holds_alternative<std::uint64_t>(left_value) && std::holds_alternative<std::uint64_t>(right_value)) {
+            auto l = std::get<std::uint64_t>(left_value);
+            auto r = std::get<std::uint64_t>(right_value);
+            switch (op) {
+                case CompareOp::eq:
+                    result = (l == r);
+                    break;
+                case CompareOp::ne:
+                    result = (l != r);
+                    break;
+                case CompareOp::gt:
+                    result = (l > r);
+                    break;
+                case CompareOp::ge:
+                    result = (l >= r);
+                    break;
+                case CompareOp::lt:
+                    result = (l < r);
+                    break;
+                case CompareOp::le:
+                    result = (l <= r);
+                    break;
+            }
+            return ExecutionResult::Success;
+        }
+        else if (std::holds_alternative<ebm::AnyRef>(left_value) && std::holds_alternative<ebm::AnyRef>(right_value)) {
+            return equality(get_id(std::get<ebm::AnyRef>(left_value)), get_id(std::get<ebm::AnyRef>(right_value)));
+        }
+        return ExecutionResult::InvalidOperator;
+    }
 
-        static void adjust_operands(EvalContext& ctx, EvalValue& left_value, EvalValue& right_value) {
-            auto adjust_any_ref = [&](EvalValue& any_ref, EvalValue& adjust_to) {
-                if (std::holds_alternative<std::string>(adjust_to)) {
-                    ctx.unwrap_any_ref<std::string>(any_ref);
+    ExecutionResult Program::run(EvalContext& ctx) const {
+        auto& stack = ctx.state.stack;
+        stack.clear();
+        size_t pc = 0;
+        while (pc < code.size()) {
+            auto& inst = code[pc];
+            pc++;
+            switch (inst.op) {
+                case OpCode::PushConst: {
+                    stack.push_back(constants[inst.operand]);
+                    break;
                 }
-                else if (std::holds_alternative<std::uint64_t>(adjust_to)) {
-                    ctx.unwrap_any_ref<std::uint64_t>(any_ref);
+                case OpCode::PushString: {
+                    stack.push_back(std::string_view(strings[inst.operand]));
+                    break;
                 }
-                else if (std::holds_alternative<bool>(adjust_to)) {
-                    ctx.unwrap_any_ref<bool>(any_ref);
+                case OpCode::LoadField: {
+                    EvalValue value;
+                    bool found = std::visit(
+                        [&](auto&& target) {
+                            if constexpr (std::is_pointer_v<std::decay_t<decltype(target)>>) {
+                                return resolve_field(fields[inst.operand], *target, value);
+                            }
+                            else {
+                                return false;
+                            }
+                        },
+                        ctx.current_target);
+                    if (!found) {
+                        return ExecutionResult::IdentifierNotFound;
+                    }
+                    stack.push_back(value);
+                    break;
+                }
+                case OpCode::LoadMember: {
+                    CHECK_AND_TAKE(base);
+                    if (!std::holds_alternative<ebm::AnyRef>(base)) {
+                        return ExecutionResult::TypeMismatch;
+                    }
+                    EvalValue value;
+                    bool found = std::visit(
+                        [&](auto&& obj) {
+                            if constexpr (std::is_pointer_v<std::decay_t<decltype(obj)>>) {
+                                return resolve_field(fields[inst.operand], *obj, value);
+                            }
+                            else {
+                                return false;
+                            }
+                        },
+                        ctx.table.get_object(std::get<ebm::AnyRef>(base)));
+                    if (!found) {
+                        return ExecutionResult::IdentifierNotFound;
+                    }
+                    stack.push_back(value);
+                    break;
+                }
+                case OpCode::Compare: {
+                    CHECK_AND_TAKE(right_value);
+                    CHECK_AND_TAKE(left_value);
+                    adjust_operands(ctx, left_value, right_value);
+                    bool result = false;
+                    if (auto res = compare_values(inst.cmp, left_value, right_value, result); res != ExecutionResult::Success) {
+                        return res;
+                    }
+                    stack.push_back(EvalValue{result});
+                    break;
+                }
+                case OpCode::Not: {
+                    CHECK_AND_TAKE_AS(value, bool);
+                    stack.push_back(EvalValue{!value});
+                    break;
+                }
+                case OpCode::Contains: {
+                    CHECK_AND_TAKE(operand_value);
+                    bool found = std::visit([&](auto& target) {
+                        if constexpr (std::is_pointer_v<std::decay_t<decltype(target)>>) {
+                            bool found = false;
+                            target->visit([&](auto&& v, auto name, auto&& value) {
+                                if (found) {
+                                    return;
+                                }
+                                if constexpr (AnyRef<decltype(value)>) {
+                                    EvalValue val{to_any_ref(value)};
+                                    adjust_operands(ctx, operand_value, val);
+                                    if (std::holds_alternative<const ObjectSet*>(operand_value) && std::holds_alternative<ebm::AnyRef>(val)) {
+                                        found = std::get<const ObjectSet*>(operand_value)->contains(std::get<ebm::AnyRef>(val));
+                                    }
+                                    else {
+                                        bool equal = false;
+                                        found = compare_values(CompareOp::eq, operand_value, val, equal) == ExecutionResult::Success && equal;
+                                    }
+                                }
+                                else
+                                    VISITOR_RECURSE_CONTAINER(v, name, value)
+                                else VISITOR_RECURSE(v, name, value)
+                            });
+                            return found;
+                        }
+                        else {
+                            return false;
+                        }
+                    },
+                                            ctx.current_target);
+                    stack.push_back(EvalValue{found});
+                    break;
+                }
+                case OpCode::JumpIfFalse:
+                case OpCode::JumpIfTrue: {
+                    CHECK_AND_TAKE_AS(value, bool);
+                    if (value == (inst.op == OpCode::JumpIfTrue)) {
+                        stack.push_back(EvalValue{value});
+                        pc = inst.operand;
+                    }
+                    break;
+                }
+                case OpCode::PushObjectSet: {
+                    // subquery does not depend on current object, so that it is evaluated once per query
+                    auto& sub = ctx.state.subqueries[inst.operand];
+                    if (!sub.evaluated) {
+                        Failures sub_failures;
+                        sub.result = subqueries[inst.operand].query(ctx.table, sub.matched, sub_failures);
+                        ctx.failures.insert(sub_failures);
+                        sub.evaluated = true;
+                    }
+                    if (sub.result != ExecutionResult::Success) {
+                        return sub.result;
+                    }
+                    stack.push_back(EvalValue{&sub.matched});
+                    break;
                 }
-            };
-            if (std::holds_alternative<ebm::AnyRef>(left_value) && !std::holds_alternative<ebm::AnyRef>(right_value)) {
-                adjust_any_ref(left_value, right_value);
-            }
-            else if (std::holds_alternative<ebm::AnyRef>(right_value) && !std::holds_alternative<ebm::AnyRef>(left_value)) {
-                adjust_any_ref(right_value, left_value);
             }
         }
+        return ExecutionResult::Success;
+    }
+
+    struct QueryCompiler {
+        MappingTable& table;
+
+        void emit(Program& program, OpCode op, std::uint32_t operand = 0, CompareOp cmp = CompareOp::eq) {
+            program.code.push_back(Instruction{.op = op, .cmp = cmp, .operand = operand});
+        }
+
+        void emit_const(Program& program, EvalValue value) {
+            emit(program, OpCode::PushConst, std::uint32_t(program.constants.size()));
+            program.constants.push_back(value);
+        }
 
-        expected<EvalFunc> compile_expr(Object& object, const std::shared_ptr<Node>& node) {
+        expected<void> compile_expr(Program& program, const std::shared_ptr<Node>& node) {
             using futils::comb2::tree::node::as_group, futils::comb2::tree::node::as_tok;
             if (auto g = as_group<NodeType>(node)) {
                 if (g->tag == NodeType::BinaryOp) {
                     if (g->children.size() == 1) {
-                        return compile_expr(object, g->children[0]);
+                        return compile_expr(program, g->children[0]);
                     }
                     else if (g->children.size() == 3) {
-                        MAYBE(left, compile_expr(object, g->children[0]));
                         auto op = as_tok<NodeType>(g->children[1]);
-                        MAYBE(right, compile_expr(object, g->children[2]));
-                        if (op && op->tag == NodeType::Operator) {
-                            if (op->token == "in") {
-                                return unexpect_error("Operator 'in' not implemented");
-                            }
-                            else if (op->token == "and" || op->token == "&&") {
-                                return [this, left = std::move(left), right = std::move(right)](EvalContext& ctx) {
-                                    return query_short_circuit(ctx, left, right, false);
-                                };
-                            }
-                            else if (op->token == "or" || op->token == "||") {
-                                return [this, left = std::move(left), right = std::move(right)](EvalContext& ctx) {
-                                    return query_short_circuit(ctx, left, right, true);
-                                };
-                            }
-                            else if (op->token == "==" || op->token == "!=" || op->token == ">" || op->token == ">=" || op->token == "<" || op->token == "<=") {
-                                return [this, left = std::move(left), right = std::move(right), op = op->token](EvalContext& ctx) {
-                                    RETURN_EXEC_FAILURE(left(ctx));
-                                    CHECK_AND_TAKE(left_value);
-                                    RETURN_EXEC_FAILURE(right(ctx));
-                                    CHECK_AND_TAKE(right_value);
-                                    adjust_operands(ctx, left_value, right_value);
-                                    bool result = false;
-                                    if (std::holds_alternative<bool>(left_value) && std::holds_alternative<bool>(right_value)) {
-                                        auto l = std::get<bool>(left_value);
-                                        auto r = std::get<bool>(right_value);
-                                        if (op == "==") {
-                                            result = (l == r);
-                                        }
-                                        else if (op == "!=") {
-                                            result = (l != r);
-                                        }
-                                        else {
-                                            return ExecutionResult::InvalidOperator;
-                                        }
-                                    }
-                                    else if (std::holds_alternative<std::string>(left_value) && std::holds_alternative<std::string>(right_value)) {
-                                        auto l = std::get<std::string>(left_value);
-                                        auto r = std::get<std::string>(right_value);
-                                        if (op == "==") {
-                                            result = (l == r);
-                                        }
-                                        else if (op == "!=") {
-                                            result = (l != r);
-                                        }
-                                        else {
-                                            return ExecutionResult::InvalidOperator;
-                                        }
-                                    }
-                                    else if (std::holds_alternative<std::uint64_t>(left_value) && std::holds_alternative<std::uint64_t>(right_value)) {
-                                        auto l = std::get<std::uint64_t>(left_value);
-                                        auto r = std::get<std::uint64_t>(right_value);
-                                        if (op == "==") {
-                                            result = (l == r);
-                                        }
-                                        else if (op == "!=") {
-                                            result = (l != r);
-                                        }
-                                        else if (op == ">") {
-                                            result = (l > r);
-                                        }
-                                        else if (op == ">=") {
-                                            result = (l >= r);
-                                        }
-                                        else if (op == "<") {
-                                            result = (l < r);
-                                        }
-                                        else if (op == "<=") {
-                                            result = (l <= r);
-                                        }
-                                        else {
-                                            return ExecutionResult::InvalidOperator;
-                                        }
-                                    }
-                                    else if (std::holds_alternative<ebm::AnyRef>(left_value) && std::holds_alternative<ebm::AnyRef>(right_value)) {
-                                        auto l = std::get<ebm::AnyRef>(left_value);
-                                        auto r = std::get<ebm::AnyRef>(right_value);
-                                        if (op == "==") {
-                                            result = (get_id(l) == get_id(r));
-                                        }
-                                        else if (op == "!=") {
-                                            result = (get_id(l) != get_id(r));
-                                        }
-                                        else {
-                                            return ExecutionResult::InvalidOperator;
-                                        }
-                                    }
-                                    else {
-                                        return ExecutionResult::InvalidOperator;
-                                    }
-                                    ctx.stack.push_back(EvalValue{result});
-                                    return ExecutionResult::Success;
-                                };
-                            }
-                            else {
-                                return unexpect_error("Unsupported binary operator: {}", op->token);
-                            }
+                        if (!op || op->tag != NodeType::Operator) {
+                            return unexpect_error("Unsupported binary operation: {}", op ? op->token : "(null)");
+                        }
+                        if (op->token == "in") {
+                            return unexpect_error("Operator 'in' not implemented");
+                        }
+                        else if (op->token == "and" || op->token == "&&" || op->token == "or" || op->token == "||") {
+                            bool is_and = op->token == "and" || op->token == "&&";
+                            MAYBE_VOID(left, compile_expr(program, g->children[0]));
+                            auto jump = program.code.size();
+                            emit(program, is_and ? OpCode::JumpIfFalse : OpCode::JumpIfTrue);
+                            MAYBE_VOID(right, compile_expr(program, g->children[2]));
+                            program.code[jump].operand = std::uint32_t(program.code.size());
+                            return {};
+                        }
+                        CompareOp cmp;
+                        if (op->token == "==") {
+                            cmp = CompareOp::eq;
                         }
-                        return unexpect_error("Unsupported binary operation: {}", op ? op->token : "(null)");
+                        else if (op->token == "!=") {
+                            cmp = CompareOp::ne;
+                        }
+                        else if (op->token == ">") {
+                            cmp = CompareOp::gt;
+                        }
+                        else if (op->token == ">=") {
+                            cmp = CompareOp::ge;
+                        }
+                        else if (op->token == "<") {
+                            cmp = CompareOp::lt;
+                        }
+                        else if (op->token == "<=") {
+                            cmp = CompareOp::le;
+                        }
+                        else {
+                            return unexpect_error("Unsupported binary operator: {}", op->token);
+                        }
+                        MAYBE_VOID(left, compile_expr(program, g->children[0]));
+                        MAYBE_VOID(right, compile_expr(program, g->children[2]));
+                        emit(program, OpCode::Compare, 0, cmp);
+                        return {};
                     }
                     else {
                         return unexpect_error("Invalid binary operation node with {} children", g->children.size());
@@ -463,71 +830,24 @@ namespace ebmgen {
                 }
                 else if (g->tag == NodeType::UnaryOp) {
                     if (g->children.size() == 1) {
-                        return compile_expr(object, g->children[0]);
+                        return compile_expr(program, g->children[0]);
                     }
                     else if (g->children.size() == 2) {
                         auto op = as_tok<NodeType>(g->children[0]);
-                        MAYBE(operand, compile_expr(object, g->children[1]));
-                        if (op && op->tag == NodeType::Operator) {
-                            if (op->token == "not" || op->token == "!") {
-                                return [operand = std::move(operand)](EvalContext& ctx) {
-                                    RETURN_EXEC_FAILURE(operand(ctx));
-                                    CHECK_AND_TAKE_AS(value, bool);
-                                    ctx.stack.push_back(EvalValue{!value});
-                                    return ExecutionResult::Success;
-                                };
-                            }
-                            else if (op->token == "contains") {
-                                return [operand = std::move(operand)](EvalContext& ctx) {
-                                    RETURN_EXEC_FAILURE(operand(ctx));
-                                    CHECK_AND_TAKE(operand_value);
-                                    bool found = std::visit([&](auto& target) {
-                                        if constexpr (std::is_pointer_v<std::decay_t<decltype(target)>>) {
-                                            bool found = false;
-                                            target->visit([&](auto&& v, auto name, auto&& value) {
-                                                if (found) {
-                                                    return;
-                                                }
-                                                if constexpr (AnyRef<decltype(value)>) {
-                                                    auto ref = to_any_ref(value);
-                                                    EvalValue val{ref};
-                                                    adjust_operands(ctx, operand_value, val);
-                                                    if (std::holds_alternative<std::string>(operand_value) && std::holds_alternative<std::string>(val)) {
-                                                        found = (std::get<std::string>(operand_value) == std::get<std::string>(val));
-                                                    }
-                                                    else if (std::holds_alternative<std::uint64_t>(operand_value) && std::holds_alternative<std::uint64_t>(val)) {
-                                                        found = (std::get<std::uint64_t>(operand_value) == std::get<std::uint64_t>(val));
-                                                    }
-                                                    else if (std::holds_alternative<bool>(operand_value) && std::holds_alternative<bool>(val)) {
-                                                        found = (std::get<bool>(operand_value) == std::get<bool>(val));
-                                                    }
-                                                    else if (std::holds_alternative<ebm::AnyRef>(operand_value) && std::holds_alternative<ebm::AnyRef>(val)) {
-                                                        found = (get_id(std::get<ebm::AnyRef>(operand_value)) == get_id(std::get<ebm::AnyRef>(val)));
-                                                    }
-                                                    else if (std::holds_alternative<ObjectSet>(operand_value) && std::holds_alternative<ebm::AnyRef>(val)) {
-                                                        found = (std::get<ObjectSet>(operand_value).contains(std::get<ebm::AnyRef>(val)));
-                                                    }
-                                                }
-                                                else
-                                                    VISITOR_RECURSE_CONTAINER(v, name, value)
-                                                else VISITOR_RECURSE(v, name, value)
-                                            });
-                                            return found;
-                                        }
-                                        else {
-                                            return false;
-                                        }
-                                    },
-                                                            ctx.current_target);
-                                    ctx.stack.push_back(EvalValue{found});
-                                    return ExecutionResult::Success;
-                                };
-                            }
-                            else {
-                                return unexpect_error("Unsupported unary operator: {}", op->token);
-                            }
+                        if (!op || op->tag != NodeType::Operator) {
+                            return unexpect_error("Unsupported unary operation: {}", op ? op->token : "(null)");
+                        }
+                        MAYBE_VOID(operand, compile_expr(program, g->children[1]));
+                        if (op->token == "not" || op->token == "!") {
+                            emit(program, OpCode::Not);
+                        }
+                        else if (op->token == "contains") {
+                            emit(program, OpCode::Contains);
                         }
-                        return unexpect_error("Unsupported unary operation: {}", op ? op->token : "(null)");
+                        else {
+                            return unexpect_error("Unsupported unary operator: {}", op->token);
+                        }
+                        return {};
                     }
                     else {
                         return unexpect_error("Invalid unary operation node with {} children", g->children.size());
@@ -535,12 +855,9 @@ namespace ebmgen {
                 }
                 else if (g->tag == NodeType::Object) {
                     MAYBE(obj, compile_object(node));
-                    return [this, obj = std::move(obj)](EvalContext& ctx) {
-                        std::unordered_set<ebm::AnyRef> matched;
-                        RETURN_EXEC_FAILURE(obj.query(this->table, matched, ctx.failures));
-                        ctx.stack.push_back(EvalValue{std::move(matched)});
-                        return ExecutionResult::Success;
-                    };
+                    emit(program, OpCode::PushObjectSet, std::uint32_t(program.subqueries.size()));
+                    program.subqueries.push_back(std::move(obj));
+                    return {};
                 }
                 else {
                     return unexpect_error("Unsupported expression group node");
@@ -552,60 +869,28 @@ namespace ebmgen {
                     if (!futils::number::prefix_integer(t->token, value)) {
                         return unexpect_error("Invalid number: {}", t->token);
                     }
-                    return [value](EvalContext& ctx) {
-                        ctx.stack.push_back(EvalValue{value});
-                        return ExecutionResult::Success;
-                    };
+                    emit_const(program, EvalValue{value});
+                    return {};
                 }
                 else if (t->tag == NodeType::Ident) {
                     if (t->token == "nil" || t->token == "null") {
-                        return [](EvalContext& ctx) {
-                            ctx.stack.push_back(EvalValue{ebm::AnyRef{0}});
-                            return ExecutionResult::Success;
-                        };
+                        emit_const(program, EvalValue{ebm::AnyRef{0}});
+                        return {};
                     }
                     if (t->token == "true") {
-                        return [](EvalContext& ctx) {
-                            ctx.stack.push_back(EvalValue{true});
-                            return ExecutionResult::Success;
-                        };
+                        emit_const(program, EvalValue{true});
+                        return {};
                     }
                     if (t->token == "false") {
-                        return [](EvalContext& ctx) {
-                            ctx.stack.push_back(EvalValue{false});
-                            return ExecutionResult::Success;
-                        };
+                        emit_const(program, EvalValue{false});
+                        return {};
                     }
                     auto per_pointer = futils::strutil::split<std::string>(t->token, "->");
-                    object.related_identifiers.insert(per_pointer[0]);
-                    return [this, per_pointer](EvalContext& ctx) {
-                        if (auto found = ctx.variables.find(per_pointer[0]); found != ctx.variables.end()) {
-                            auto result = found->second;
-                            for (size_t i = 1; i < per_pointer.size(); i++) {
-                                if (!std::holds_alternative<ebm::AnyRef>(result)) {
-                                    return ExecutionResult::TypeMismatch;
-                                }
-                                const auto& part = per_pointer[i];
-                                std::unordered_set<std::string> member_idents{part};
-                                auto v = table.get_object(std::get<ebm::AnyRef>(result));
-                                std::map<std::string, EvalValue> members;
-                                std::visit(
-                                    [&](auto&& obj) {
-                                        if constexpr (std::is_pointer_v<std::decay_t<decltype(obj)>>) {
-                                            collect_variables(members, member_idents, *obj);
-                                        }
-                                    },
-                                    v);
-                                if (members.empty()) {
-                                    return ExecutionResult::IdentifierNotFound;
-                                }
-                                result = std::move(members[part]);
-                            }
-                            ctx.stack.push_back(std::move(result));
-                            return ExecutionResult::Success;
-                        }
-                        return ExecutionResult::IdentifierNotFound;
-                    };
+                    for (size_t i = 0; i < per_pointer.size(); i++) {
+                        emit(program, i == 0 ? OpCode::LoadField : OpCode::LoadMember, std::uint32_t(program.fields.size()));
+                        program.fields.push_back(FieldPath::parse(per_pointer[i]));
+                    }
+                    return {};
                 }
                 else if (t->tag == NodeType::StringLit) {
                     std::string value;
@@ -615,15 +900,76 @@ namespace ebmgen {
                     if (!futils::escape::unescape_str(removed_quotes, value)) {
                         return unexpect_error("Invalid string literal: {}", t->token);
                     }
-                    return [value = std::move(value)](EvalContext& ctx) {
-                        ctx.stack.push_back(EvalValue{value});
-                        return ExecutionResult::Success;
-                    };
+                    emit(program, OpCode::PushString, std::uint32_t(program.strings.size()));
+                    program.strings.push_back(std::move(value));
+                    return {};
                 }
             }
             return unexpect_error("Unsupported expression node");
         }
 
+        static std::shared_ptr<Node> unwrap_single(std::shared_ptr<Node> node) {
+            using futils::comb2::tree::node::as_group;
+            while (auto g = as_group<NodeType>(node)) {
+                if (g->children.size() != 1 || (g->tag != NodeType::BinaryOp && g->tag != NodeType::UnaryOp)) {
+                    break;
+                }
+                node = g->children[0];
+            }
+            return node;
+        }
+
+        // collect `ident == literal` predicates combined with `and` at top level of object
+        // these are used only to narrow candidates; evaluator still checks them
+        void collect_index_keys(Object& object, const std::shared_ptr<Node>& node) {
+            using futils::comb2::tree::node::as_group, futils::comb2::tree::node::as_tok;
+            auto g = as_group<NodeType>(unwrap_single(node));
+            if (!g || g->tag != NodeType::BinaryOp || g->children.size() != 3) {
+                return;
+            }
+            auto op = as_tok<NodeType>(g->children[1]);
+            if (!op || op->tag != NodeType::Operator) {
+                return;
+            }
+            if (op->token == "and" || op->token == "&&") {
+                collect_index_keys(object, g->children[0]);
+                collect_index_keys(object, g->children[2]);
+                return;
+            }
+            if (op->token != "==") {
+                return;
+            }
+            auto ident = as_tok<NodeType>(unwrap_single(g->children[0]));
+            auto literal = as_tok<NodeType>(unwrap_single(g->children[2]));
+            if (ident && ident->tag != NodeType::Ident) {
+                std::swap(ident, literal);
+            }
+            if (!ident || !literal || ident->tag != NodeType::Ident) {
+                return;
+            }
+            if (literal->tag == NodeType::Number) {
+                std::uint64_t value;
+                if (ident->token == "id" && futils::number::prefix_integer(literal->token, value)) {
+                    object.index_keys.push_back(IndexKey{.kind = IndexKey::Kind::Id, .id = value});
+                }
+            }
+            else if (literal->tag == NodeType::StringLit) {
+                std::string value;
+                auto removed_quotes = literal->token;
+                removed_quotes.erase(0, 1);
+                removed_quotes.pop_back();
+                if (!futils::escape::unescape_str(removed_quotes, value)) {
+                    return;
+                }
+                if (ident->token == "id") {
+                    object.index_keys.push_back(IndexKey{.kind = IndexKey::Kind::IdentifierName, .value = std::move(value)});
+                }
+                else if (ident->token == "body.kind") {
+                    object.index_keys.push_back(IndexKey{.kind = IndexKey::Kind::KindName, .value = std::move(value)});
+                }
+            }
+        }
+
         expected<Object> compile_object(const std::shared_ptr<Node>& node) {
             using futils::comb2::tree::node::as_group, futils::comb2::tree::node::as_tok;
             if (auto g = as_group<NodeType>(node)) {
@@ -635,8 +981,8 @@ namespace ebmgen {
                         }
                         auto expr_node = g->children[1];
                         Object obj;
-                        MAYBE(fn, compile_expr(obj, expr_node));
-                        obj.evaluator = std::move(fn);
+                        MAYBE_VOID(compiled, compile_expr(obj.program, expr_node));
+                        collect_index_keys(obj, expr_node);
                         obj.type = type_tok->token;
                         return obj;
                     }
@@ -783,7 +1129,7 @@ namespace ebmgen {
             size_t count = 0;
             ObjectSet matched;
             Failures failures;
-            query.query(table, matched, failures);
+            query.query(table, matched, failures, nullptr, resolve_thread_count(0));
             for (auto& ref : matched) {
                 auto obj = table.get_object(ref);
                 std::visit(
@@ -944,7 +1290,7 @@ namespace ebmgen {
         debugger.start();
     }
 
-    expected<std::pair<ObjectResult, Failures>> run_query(MappingTable& table, std::string_view input) {
+    expected<std::pair<ObjectResult, Failures>> run_query(MappingTable& table, std::string_view input, size_t threads) {
         std::uint64_t id = 0;
         if (futils::number::prefix_integer(input, id)) {
             if (table.get_object(ebm::AnyRef{id}).index() == 0) {
@@ -966,7 +1312,7 @@ namespace ebmgen {
         ObjectSet matched;
         ObjectResult matched_result;
         Failures failures;
-        query.query(table, matched, failures, &matched_result);
+        query.query(table, matched, failures, &matched_result, resolve_thread_count(threads));
         return std::make_pair(std::move(matched_result), std::move(failures));
     }
 }  // namespace ebmgen
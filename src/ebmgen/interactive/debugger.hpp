@@ -38,5 +38,6 @@ namespace ebmgen {
         }
     }
     using Failures = std::set<ExecutionResult>;
-    expected<std::pair<ObjectResult, Failures>> run_query(MappingTable& table, std::string_view input);
+    // threads == 0 means hardware concurrency
+    expected<std::pair<ObjectResult, Failures>> run_query(MappingTable& table, std::string_view input, size_t threads = 1);
 }  // namespace ebmgen
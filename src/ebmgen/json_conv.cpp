@@ -3710,6 +3710,14 @@ namespace ebm {
                 obj = LoweringIOType::VECTORIZED_IO;
                 return true;
             }
+            if (s == "FIXED_LAYOUT_DECODE") {
+                obj = LoweringIOType::FIXED_LAYOUT_DECODE;
+                return true;
+            }
+            if (s == "BULK_PRIMITIVE_ARRAY") {
+                obj = LoweringIOType::BULK_PRIMITIVE_ARRAY;
+                return true;
+            }
             return false;
         }
         return false;
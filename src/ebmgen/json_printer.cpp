@@ -20,6 +20,7 @@ namespace ebmgen {
                 element([&] {
                     print_value(elem);
                 });
+                flush(false);
             }
         }
         else if constexpr (std::is_same_v<T, ebm::Varint>) {
@@ -66,12 +67,26 @@ namespace ebmgen {
         }
     }
 
+    bool JSONPrinter::flush(bool force) const {
+        if (!sink_ || !os_) {
+            return true;
+        }
+        auto& buf = os_->out();
+        if (buf.empty() || (!force && buf.size() < flush_threshold_)) {
+            return true;
+        }
+        auto ok = sink_->write(buf);
+        buf.clear();  // stringer holds nesting state separately from buffer
+        return ok;
+    }
+
     void JSONPrinter::print_module(futils::json::Stringer<>& os) {
         os_ = &os;
         auto origin = module_.module().origin;
         if (origin) {
             print_value(*origin);
         }
+        flush();
     }
 
     void JSONPrinter ::print_object(futils::json::Stringer<>& os, const ebm::Statement& obj) {
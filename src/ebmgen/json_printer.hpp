@@ -3,6 +3,7 @@
 
 #include "ebmgen/mapping.hpp"
 #include "json/stringer.h"
+#include <binary/writer.h>
 namespace ebmgen {
     struct JSONPrinter {
        public:
@@ -10,6 +11,15 @@ namespace ebmgen {
 
         void print_module(futils::json::Stringer<>&);
 
+        // when sink is set, buffered output of stringer is moved to sink
+        // each time it exceeds threshold, and at the end of print_module
+        void set_sink(futils::binary::writer* sink, size_t threshold = 64 * 1024) {
+            sink_ = sink;
+            flush_threshold_ = threshold;
+        }
+
+        bool flush(bool force = true) const;
+
         void print_object(futils::json::Stringer<>&, const ebm::Statement& obj);
         void print_object(futils::json::Stringer<>&, const ebm::Expression& obj);
         void print_object(futils::json::Stringer<>&, const ebm::Type& obj);
@@ -19,6 +29,8 @@ namespace ebmgen {
        private:
         futils::json::Stringer<>* os_;  // Reference to the output stream
         const MappingTable& module_;
+        futils::binary::writer* sink_ = nullptr;
+        size_t flush_threshold_ = 0;
 
         template <typename T>
         void print_value(const T& value) const;
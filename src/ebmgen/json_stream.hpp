@@ -0,0 +1,330 @@
+/*license*/
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ebmgen {
+    // pull style JSON reader for schema driven decoder (json_stream_conv.cpp)
+    // values are decoded directly into target objects without building JSON DOM
+    struct JSONStreamReader {
+        explicit JSONStreamReader(std::string_view input)
+            : input_(input) {}
+
+        size_t offset() const {
+            return pos_;
+        }
+
+        bool at_end() {
+            skip_ws();
+            return pos_ == input_.size();
+        }
+
+        // call on_key(key) for each member; on_key must consume the value
+        // key is valid until next read
+        bool read_object(auto&& on_key) {
+            if (!consume('{')) {
+                return false;
+            }
+            if (consume('}')) {
+                return true;
+            }
+            while (true) {
+                std::string_view key;
+                if (!read_string(key) || !consume(':')) {
+                    return false;
+                }
+                if (!on_key(key)) {
+                    return false;
+                }
+                if (consume(',')) {
+                    continue;
+                }
+                return consume('}');
+            }
+        }
+
+        // call on_element() for each element; on_element must consume the value
+        bool read_array(auto&& on_element) {
+            if (!consume('[')) {
+                return false;
+            }
+            if (consume(']')) {
+                return true;
+            }
+            while (true) {
+                if (!on_element()) {
+                    return false;
+                }
+                if (consume(',')) {
+                    continue;
+                }
+                return consume(']');
+            }
+        }
+
+        // result refers input directly if string has no escape sequence
+        // otherwise refers internal buffer
+        bool read_string(std::string_view& out) {
+            if (!consume('"')) {
+                return false;
+            }
+            const auto begin = pos_;
+            while (pos_ < input_.size() && input_[pos_] != '"' && input_[pos_] != '\\') {
+                pos_++;
+            }
+            if (pos_ >= input_.size()) {
+                return false;
+            }
+            if (input_[pos_] == '"') {
+                out = input_.substr(begin, pos_ - begin);
+                pos_++;
+                return true;
+            }
+            scratch_.assign(input_.substr(begin, pos_ - begin));
+            while (pos_ < input_.size()) {
+                auto c = input_[pos_++];
+                if (c == '"') {
+                    out = scratch_;
+                    return true;
+                }
+                if (c != '\\') {
+                    scratch_.push_back(c);
+                    continue;
+                }
+                if (pos_ >= input_.size()) {
+                    return false;
+                }
+                switch (input_[pos_++]) {
+                    case '"':
+                        scratch_.push_back('"');
+                        break;
+                    case '\\':
+                        scratch_.push_back('\\');
+                        break;
+                    case '/':
+                        scratch_.push_back('/');
+                        break;
+                    case 'b':
+                        scratch_.push_back('\b');
+                        break;
+                    case 'f':
+                        scratch_.push_back('\f');
+                        break;
+                    case 'n':
+                        scratch_.push_back('\n');
+                        break;
+                    case 'r':
+                        scratch_.push_back('\r');
+                        break;
+                    case 't':
+                        scratch_.push_back('\t');
+                        break;
+                    case 'u': {
+                        std::uint32_t code = 0;
+                        if (!read_hex4(code)) {
+                            return false;
+                        }
+                        if (code >= 0xD800 && code <= 0xDBFF) {
+                            std::uint32_t low = 0;
+                            if (!consume_raw('\\') || !consume_raw('u') || !read_hex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                                return false;
+                            }
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        }
+                        append_utf8(code);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+            }
+            return false;
+        }
+
+        bool read_string(std::string& out) {
+            std::string_view view;
+            if (!read_string(view)) {
+                return false;
+            }
+            out.assign(view);
+            return true;
+        }
+
+        bool read_uint(std::uint64_t& out) {
+            skip_ws();
+            if (pos_ >= input_.size() || !is_digit(input_[pos_])) {
+                return false;
+            }
+            std::uint64_t value = 0;
+            while (pos_ < input_.size() && is_digit(input_[pos_])) {
+                auto digit = std::uint64_t(input_[pos_] - '0');
+                if (value > (~std::uint64_t(0) - digit) / 10) {
+                    return false;  // overflow
+                }
+                value = value * 10 + digit;
+                pos_++;
+            }
+            out = value;
+            return true;
+        }
+
+        bool read_bool(bool& out) {
+            skip_ws();
+            if (input_.substr(pos_, 4) == "true") {
+                pos_ += 4;
+                out = true;
+                return true;
+            }
+            if (input_.substr(pos_, 5) == "false") {
+                pos_ += 5;
+                out = false;
+                return true;
+            }
+            return false;
+        }
+
+        // skip value of unknown key
+        bool skip_value() {
+            skip_ws();
+            if (pos_ >= input_.size()) {
+                return false;
+            }
+            switch (input_[pos_]) {
+                case '{':
+                    return read_object([&](std::string_view) { return skip_value(); });
+                case '[':
+                    return read_array([&] { return skip_value(); });
+                case '"': {
+                    std::string_view s;
+                    return read_string(s);
+                }
+                case 't':
+                case 'f': {
+                    bool b;
+                    return read_bool(b);
+                }
+                case 'n':
+                    if (input_.substr(pos_, 4) == "null") {
+                        pos_ += 4;
+                        return true;
+                    }
+                    return false;
+                default: {
+                    if (input_[pos_] == '-') {
+                        pos_++;
+                    }
+                    const auto begin = pos_;
+                    while (pos_ < input_.size() && (is_digit(input_[pos_]) || input_[pos_] == '.' || input_[pos_] == 'e' ||
+                                                    input_[pos_] == 'E' || input_[pos_] == '+' || input_[pos_] == '-')) {
+                        pos_++;
+                    }
+                    return pos_ != begin;
+                }
+            }
+        }
+
+       private:
+        std::string_view input_;
+        size_t pos_ = 0;
+        std::string scratch_;
+
+        static constexpr bool is_digit(char c) {
+            return '0' <= c && c <= '9';
+        }
+
+        void skip_ws() {
+            while (pos_ < input_.size() && (input_[pos_] == ' ' || input_[pos_] == '\n' || input_[pos_] == '\r' || input_[pos_] == '\t')) {
+                pos_++;
+            }
+        }
+
+        bool consume(char c) {
+            skip_ws();
+            return consume_raw(c);
+        }
+
+        bool consume_raw(char c) {
+            if (pos_ < input_.size() && input_[pos_] == c) {
+                pos_++;
+                return true;
+            }
+            return false;
+        }
+
+        bool read_hex4(std::uint32_t& out) {
+            if (input_.size() - pos_ < 4) {
+                return false;
+            }
+            out = 0;
+            for (size_t i = 0; i < 4; i++) {
+                auto c = input_[pos_++];
+                out <<= 4;
+                if (is_digit(c)) {
+                    out |= c - '0';
+                }
+                else if ('a' <= c && c <= 'f') {
+                    out |= c - 'a' + 10;
+                }
+                else if ('A' <= c && c <= 'F') {
+                    out |= c - 'A' + 10;
+                }
+                else {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void append_utf8(std::uint32_t code) {
+            if (code < 0x80) {
+                scratch_.push_back(char(code));
+            }
+            else if (code < 0x800) {
+                scratch_.push_back(char(0xC0 | (code >> 6)));
+                scratch_.push_back(char(0x80 | (code & 0x3F)));
+            }
+            else if (code < 0x10000) {
+                scratch_.push_back(char(0xE0 | (code >> 12)));
+                scratch_.push_back(char(0x80 | ((code >> 6) & 0x3F)));
+                scratch_.push_back(char(0x80 | (code & 0x3F)));
+            }
+            else {
+                scratch_.push_back(char(0xF0 | (code >> 18)));
+                scratch_.push_back(char(0x80 | ((code >> 12) & 0x3F)));
+                scratch_.push_back(char(0x80 | ((code >> 6) & 0x3F)));
+                scratch_.push_back(char(0x80 | (code & 0x3F)));
+            }
+        }
+    };
+
+    // primitive decoders; generated decoders of ebm structs are found by ADL
+    inline bool from_json_stream(bool& obj, JSONStreamReader& r) {
+        return r.read_bool(obj);
+    }
+
+    inline bool from_json_stream(std::string& obj, JSONStreamReader& r) {
+        return r.read_string(obj);
+    }
+
+    template <class T>
+        requires std::is_unsigned_v<T> && (!std::is_same_v<T, bool>)
+    bool from_json_stream(T& obj, JSONStreamReader& r) {
+        std::uint64_t value;
+        if (!r.read_uint(value) || value > std::uint64_t(T(~T(0)))) {
+            return false;
+        }
+        obj = T(value);
+        return true;
+    }
+
+    template <class T>
+    bool from_json_stream(std::vector<T>& obj, JSONStreamReader& r) {
+        obj.clear();
+        return r.read_array([&] {
+            return from_json_stream(obj.emplace_back(), r);
+        });
+    }
+}  // namespace ebmgen
@@ -0,0 +1,4946 @@
+/*license*/
+// Code generated by ebmcodegen at https://github.com/on-keyday/rebrgen
+#include "json_stream_conv.hpp"
+namespace ebm {
+    bool from_json_stream(AnyRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = AnyRef{id};
+        return true;
+    }
+    
+    bool from_json_stream(AssertDesc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 9: {
+                    if (key == "condition") {
+                        found |= 0x1;
+                        return from_json_stream(obj.condition, r);
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "lowered_statement") {
+                        found |= 0x2;
+                        return from_json_stream(obj.lowered_statement, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(Block& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 3: {
+                    if (key == "len") {
+                        found |= 0x1;
+                        return from_json_stream(obj.len, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "container") {
+                        found |= 0x2;
+                        return from_json_stream(obj.container, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(CallDesc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "callee") {
+                        found |= 0x1;
+                        return from_json_stream(obj.callee, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "arguments") {
+                        found |= 0x2;
+                        return from_json_stream(obj.arguments, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(CompositeFieldDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "kind") {
+                        found |= 0x4;
+                        return from_json_stream(obj.kind, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "fields") {
+                        found |= 0x1;
+                        return from_json_stream(obj.fields, r);
+                    }
+                    break;
+                }
+                case 14: {
+                    if (key == "composite_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.composite_type, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(Condition& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "cond") {
+                        found |= 0x1;
+                        return from_json_stream(obj.cond, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(DebugInfo& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "locs") {
+                        found |= 0x8;
+                        return from_json_stream(obj.locs, r);
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "files") {
+                        found |= 0x2;
+                        return from_json_stream(obj.files, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "len_locs") {
+                        found |= 0x4;
+                        return from_json_stream(obj.len_locs, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "len_files") {
+                        found |= 0x1;
+                        return from_json_stream(obj.len_files, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0xf) == 0xf;
+    }
+    
+    bool from_json_stream(EndianConvertDesc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "endian") {
+                        found |= 0x1;
+                        Endian tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian(std::move(tmp)));
+                    }
+                    if (key == "target") {
+                        found |= 0x4;
+                        return from_json_stream(obj.target, r);
+                    }
+                    if (key == "source") {
+                        found |= 0x8;
+                        return from_json_stream(obj.source, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x2;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "lowered_statement") {
+                        found |= 0x10;
+                        return from_json_stream(obj.lowered_statement, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1f) == 0x1f;
+    }
+    
+    bool from_json_stream(EndianVariable& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "endian") {
+                        found |= 0x1;
+                        Endian tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x2;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "dynamic_expr") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.dynamic_expr(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(EnumDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "members") {
+                        found |= 0x4;
+                        return from_json_stream(obj.members, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "base_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.base_type, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(EnumMemberDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "value") {
+                        found |= 0x4;
+                        return from_json_stream(obj.value, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "enum_decl") {
+                        found |= 0x2;
+                        return from_json_stream(obj.enum_decl, r);
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "string_repr") {
+                        found |= 0x8;
+                        return from_json_stream(obj.string_repr, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0xf) == 0xf;
+    }
+    
+    bool from_json_stream(ErrorReport& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 7: {
+                    if (key == "message") {
+                        found |= 0x1;
+                        return from_json_stream(obj.message, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "arguments") {
+                        found |= 0x2;
+                        return from_json_stream(obj.arguments, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(Expression& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(ExpressionBody& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.id(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 3: {
+                    if (key == "bop") {
+                        BinaryOp tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.bop(std::move(tmp)));
+                    }
+                    if (key == "end") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.end(std::move(tmp)));
+                    }
+                    if (key == "uop") {
+                        UnaryOp tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.uop(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.type, r);
+                    }
+                    if (key == "kind") {
+                        found |= 0x2;
+                        return from_json_stream(obj.kind, r);
+                    }
+                    if (key == "base") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.base(std::move(tmp)));
+                    }
+                    if (key == "left") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.left(std::move(tmp)));
+                    }
+                    if (key == "then") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.then(std::move(tmp)));
+                    }
+                    if (key == "unit") {
+                        SizeUnit tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.unit(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "else_") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.else_(std::move(tmp)));
+                    }
+                    if (key == "index") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.index(std::move(tmp)));
+                    }
+                    if (key == "right") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.right(std::move(tmp)));
+                    }
+                    if (key == "start") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.start(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "io_ref") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.io_ref(std::move(tmp)));
+                    }
+                    if (key == "member") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.member(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "operand") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.operand(std::move(tmp)));
+                    }
+                    if (key == "or_cond") {
+                        Expressions tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.or_cond(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "type_ref") {
+                        TypeRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.type_ref(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "call_desc") {
+                        CallDesc tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.call_desc(std::move(tmp)));
+                    }
+                    if (key == "condition") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.condition(std::move(tmp)));
+                    }
+                    if (key == "enum_decl") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.enum_decl(std::move(tmp)));
+                    }
+                    if (key == "int_value") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.int_value(std::move(tmp)));
+                    }
+                    if (key == "num_bytes") {
+                        Size tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.num_bytes(std::move(tmp)));
+                    }
+                    if (key == "sub_range") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.sub_range(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "array_expr") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.array_expr(std::move(tmp)));
+                    }
+                    if (key == "bool_value") {
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.bool_value(std::move(tmp)));
+                    }
+                    if (key == "char_value") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.char_value(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "endian_expr") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian_expr(std::move(tmp)));
+                    }
+                    if (key == "int64_value") {
+                        std::uint64_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.int64_value(std::move(tmp)));
+                    }
+                    if (key == "stream_type") {
+                        StreamType tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.stream_type(std::move(tmp)));
+                    }
+                    if (key == "target_expr") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.target_expr(std::move(tmp)));
+                    }
+                    if (key == "target_stmt") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.target_stmt(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "io_statement") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.io_statement(std::move(tmp)));
+                    }
+                    if (key == "lowered_expr") {
+                        LoweredExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.lowered_expr(std::move(tmp)));
+                    }
+                    if (key == "string_value") {
+                        StringRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.string_value(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "setter_status") {
+                        SetterStatus tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.setter_status(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 14: {
+                    if (key == "type_cast_desc") {
+                        TypeCastDesc tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.type_cast_desc(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "conditional_stmt") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.conditional_stmt(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(ExpressionRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = ExpressionRef{id};
+        return true;
+    }
+    
+    bool from_json_stream(Expressions& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 3: {
+                    if (key == "len") {
+                        found |= 0x1;
+                        return from_json_stream(obj.len, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "container") {
+                        found |= 0x2;
+                        return from_json_stream(obj.container, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(ExtendedBinaryModule& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 5: {
+                    if (key == "types") {
+                        found |= 0x80;
+                        return from_json_stream(obj.types, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "max_id") {
+                        found |= 0x2;
+                        return from_json_stream(obj.max_id, r);
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "version") {
+                        found |= 0x1;
+                        return from_json_stream(obj.version, r);
+                    }
+                    if (key == "strings") {
+                        found |= 0x20;
+                        return from_json_stream(obj.strings, r);
+                    }
+                    if (key == "aliases") {
+                        found |= 0x2000;
+                        return from_json_stream(obj.aliases, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "types_len") {
+                        found |= 0x40;
+                        return from_json_stream(obj.types_len, r);
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "statements") {
+                        found |= 0x200;
+                        return from_json_stream(obj.statements, r);
+                    }
+                    if (key == "debug_info") {
+                        found |= 0x4000;
+                        return from_json_stream(obj.debug_info, r);
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "identifiers") {
+                        found |= 0x8;
+                        return from_json_stream(obj.identifiers, r);
+                    }
+                    if (key == "strings_len") {
+                        found |= 0x10;
+                        return from_json_stream(obj.strings_len, r);
+                    }
+                    if (key == "expressions") {
+                        found |= 0x800;
+                        return from_json_stream(obj.expressions, r);
+                    }
+                    if (key == "aliases_len") {
+                        found |= 0x1000;
+                        return from_json_stream(obj.aliases_len, r);
+                    }
+                    break;
+                }
+                case 14: {
+                    if (key == "statements_len") {
+                        found |= 0x100;
+                        return from_json_stream(obj.statements_len, r);
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "identifiers_len") {
+                        found |= 0x4;
+                        return from_json_stream(obj.identifiers_len, r);
+                    }
+                    if (key == "expressions_len") {
+                        found |= 0x400;
+                        return from_json_stream(obj.expressions_len, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7fff) == 0x7fff;
+    }
+    
+    bool from_json_stream(FieldDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x40;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    if (key == "metadata") {
+                        Block tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.metadata(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "field_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.field_type, r);
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "has_metadata") {
+                        found |= 0x20;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_metadata(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "parent_struct") {
+                        found |= 0x4;
+                        return from_json_stream(obj.parent_struct, r);
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "inner_composite") {
+                        found |= 0x10;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.inner_composite(std::move(tmp));
+                        return true;
+                    }
+                    if (key == "composite_field") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.composite_field(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "composite_getter") {
+                        LoweredStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.composite_getter(std::move(tmp)));
+                    }
+                    if (key == "composite_setter") {
+                        LoweredStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.composite_setter(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "is_state_variable") {
+                        found |= 0x8;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_state_variable(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7f) == 0x7f;
+    }
+    
+    bool from_json_stream(FuncTypeDesc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "params") {
+                        found |= 0x2;
+                        return from_json_stream(obj.params, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x8;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "annotation") {
+                        found |= 0x4;
+                        FuncTypeAnnotation tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.annotation(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "return_type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.return_type, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0xf) == 0xf;
+    }
+    
+    bool from_json_stream(FunctionDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    if (key == "kind") {
+                        found |= 0x10;
+                        return from_json_stream(obj.kind, r);
+                    }
+                    if (key == "body") {
+                        found |= 0x20;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "params") {
+                        found |= 0x4;
+                        return from_json_stream(obj.params, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "property") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.property(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "return_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.return_type, r);
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "parent_format") {
+                        found |= 0x8;
+                        return from_json_stream(obj.parent_format, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3f) == 0x3f;
+    }
+    
+    bool from_json_stream(IOAttribute& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "sign") {
+                        found |= 0x2;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.sign(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "endian") {
+                        found |= 0x1;
+                        Endian tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "is_peek") {
+                        found |= 0x4;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_peek(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x20;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.reserved(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "has_offset") {
+                        found |= 0x10;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_offset(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "dynamic_ref") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.dynamic_ref(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 21: {
+                    if (key == "has_lowered_statement") {
+                        found |= 0x8;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_lowered_statement(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3f) == 0x3f;
+    }
+    
+    bool from_json_stream(IOData& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "size") {
+                        found |= 0x20;
+                        return from_json_stream(obj.size, r);
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "field") {
+                        found |= 0x2;
+                        return from_json_stream(obj.field, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "io_ref") {
+                        found |= 0x1;
+                        return from_json_stream(obj.io_ref, r);
+                    }
+                    if (key == "target") {
+                        found |= 0x4;
+                        return from_json_stream(obj.target, r);
+                    }
+                    if (key == "offset") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.offset(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "data_type") {
+                        found |= 0x8;
+                        return from_json_stream(obj.data_type, r);
+                    }
+                    if (key == "attribute") {
+                        found |= 0x10;
+                        return from_json_stream(obj.attribute, r);
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "lowered_statement") {
+                        LoweredIOStatement tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.lowered_statement(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3f) == 0x3f;
+    }
+    
+    bool from_json_stream(Identifier& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(IdentifierRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = IdentifierRef{id};
+        return true;
+    }
+    
+    bool from_json_stream(IfStatement& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 9: {
+                    if (key == "condition") {
+                        found |= 0x1;
+                        return from_json_stream(obj.condition, r);
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "then_block") {
+                        found |= 0x2;
+                        return from_json_stream(obj.then_block, r);
+                    }
+                    if (key == "else_block") {
+                        found |= 0x4;
+                        return from_json_stream(obj.else_block, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(ImportDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    if (key == "path") {
+                        found |= 0x2;
+                        return from_json_stream(obj.path, r);
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "program") {
+                        found |= 0x4;
+                        return from_json_stream(obj.program, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(InitCheck& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 12: {
+                    if (key == "target_field") {
+                        found |= 0x2;
+                        return from_json_stream(obj.target_field, r);
+                    }
+                    if (key == "expect_value") {
+                        found |= 0x4;
+                        return from_json_stream(obj.expect_value, r);
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "init_check_type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.init_check_type, r);
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "related_function") {
+                        found |= 0x8;
+                        return from_json_stream(obj.related_function, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0xf) == 0xf;
+    }
+    
+    bool from_json_stream(Instruction& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "op") {
+                        found |= 0x1;
+                        return from_json_stream(obj.op, r);
+                    }
+                    break;
+                }
+                case 3: {
+                    if (key == "imm") {
+                        OptionalImmediateSize tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.imm(std::move(tmp)));
+                    }
+                    if (key == "reg") {
+                        RegisterIndex tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reg(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "value") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.value(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "msg_id") {
+                        StringRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.msg_id(std::move(tmp)));
+                    }
+                    if (key == "offset") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.offset(std::move(tmp)));
+                    }
+                    if (key == "str_id") {
+                        StringRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.str_id(std::move(tmp)));
+                    }
+                    if (key == "target") {
+                        JumpOffset tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.target(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "arg_num") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.arg_num(std::move(tmp)));
+                    }
+                    if (key == "func_id") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.func_id(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "cast_type") {
+                        CastType tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.cast_type(std::move(tmp)));
+                    }
+                    if (key == "member_id") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.member_id(std::move(tmp)));
+                    }
+                    if (key == "struct_id") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.struct_id(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "set_endian") {
+                        SetEndian tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.set_endian(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(JumpOffset& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "offset") {
+                        found |= 0x4;
+                        return from_json_stream(obj.offset, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "backward") {
+                        found |= 0x1;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.backward(std::move(tmp));
+                        return true;
+                    }
+                    if (key == "reserved") {
+                        found |= 0x2;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(LengthCheck& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "target") {
+                        found |= 0x1;
+                        return from_json_stream(obj.target, r);
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "expected_length") {
+                        found |= 0x2;
+                        return from_json_stream(obj.expected_length, r);
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "related_function") {
+                        found |= 0x4;
+                        return from_json_stream(obj.related_function, r);
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "lowered_statement") {
+                        found |= 0x8;
+                        return from_json_stream(obj.lowered_statement, r);
+                    }
+                    if (key == "length_check_type") {
+                        found |= 0x10;
+                        return from_json_stream(obj.length_check_type, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1f) == 0x1f;
+    }
+    
+    bool from_json_stream(Loc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 3: {
+                    if (key == "end") {
+                        found |= 0x20;
+                        return from_json_stream(obj.end, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "line") {
+                        found |= 0x4;
+                        return from_json_stream(obj.line, r);
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "ident") {
+                        found |= 0x1;
+                        return from_json_stream(obj.ident, r);
+                    }
+                    if (key == "start") {
+                        found |= 0x10;
+                        return from_json_stream(obj.start, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "column") {
+                        found |= 0x8;
+                        return from_json_stream(obj.column, r);
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "file_id") {
+                        found |= 0x2;
+                        return from_json_stream(obj.file_id, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3f) == 0x3f;
+    }
+    
+    bool from_json_stream(LoopFlowControl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 17: {
+                    if (key == "related_statement") {
+                        found |= 0x1;
+                        return from_json_stream(obj.related_statement, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(LoopStatement& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "init") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.init(std::move(tmp)));
+                    }
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "item_var") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.item_var(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "loop_type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.loop_type, r);
+                    }
+                    if (key == "condition") {
+                        Condition tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.condition(std::move(tmp)));
+                    }
+                    if (key == "increment") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.increment(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "collection") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.collection(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "lowered_statement") {
+                        found |= 0x4;
+                        return from_json_stream(obj.lowered_statement, r);
+                    }
+                    if (key == "next_lowered_loop") {
+                        found |= 0x8;
+                        return from_json_stream(obj.next_lowered_loop, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0xf) == 0xf;
+    }
+    
+    bool from_json_stream(LoweredExpressionRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(LoweredIOStatement& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 12: {
+                    if (key == "io_statement") {
+                        found |= 0x2;
+                        return from_json_stream(obj.io_statement, r);
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "lowering_type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.lowering_type, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(LoweredIOStatements& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 3: {
+                    if (key == "len") {
+                        found |= 0x1;
+                        return from_json_stream(obj.len, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "container") {
+                        found |= 0x2;
+                        return from_json_stream(obj.container, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(LoweredStatementRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(MatchBranch& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "condition") {
+                        found |= 0x1;
+                        return from_json_stream(obj.condition, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(MatchStatement& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "target") {
+                        found |= 0x1;
+                        return from_json_stream(obj.target, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x4;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    if (key == "branches") {
+                        found |= 0x8;
+                        return from_json_stream(obj.branches, r);
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "is_exhaustive") {
+                        found |= 0x2;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_exhaustive(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 20: {
+                    if (key == "lowered_if_statement") {
+                        found |= 0x10;
+                        return from_json_stream(obj.lowered_if_statement, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1f) == 0x1f;
+    }
+    
+    bool from_json_stream(Metadata& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "values") {
+                        found |= 0x2;
+                        return from_json_stream(obj.values, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(OptionalImmediateSize& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "size") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.size(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x2;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "is_immediate") {
+                        found |= 0x1;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_immediate(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(ParameterDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x8;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "param_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.param_type, r);
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "is_state_variable") {
+                        found |= 0x4;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_state_variable(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0xf) == 0xf;
+    }
+    
+    bool from_json_stream(PropertyDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "members") {
+                        found |= 0x40;
+                        return from_json_stream(obj.members, r);
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "merge_mode") {
+                        found |= 0x8;
+                        return from_json_stream(obj.merge_mode, r);
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "derived_from") {
+                        Block tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.derived_from(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "parent_format") {
+                        found |= 0x2;
+                        return from_json_stream(obj.parent_format, r);
+                    }
+                    if (key == "property_type") {
+                        found |= 0x4;
+                        return from_json_stream(obj.property_type, r);
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "setter_function") {
+                        found |= 0x80;
+                        return from_json_stream(obj.setter_function, r);
+                    }
+                    if (key == "getter_function") {
+                        found |= 0x100;
+                        return from_json_stream(obj.getter_function, r);
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "setter_condition") {
+                        found |= 0x10;
+                        return from_json_stream(obj.setter_condition, r);
+                    }
+                    if (key == "getter_condition") {
+                        found |= 0x20;
+                        return from_json_stream(obj.getter_condition, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1ff) == 0x1ff;
+    }
+    
+    bool from_json_stream(PropertyMemberDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 5: {
+                    if (key == "field") {
+                        found |= 0x4;
+                        return from_json_stream(obj.field, r);
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "setter_condition") {
+                        found |= 0x1;
+                        return from_json_stream(obj.setter_condition, r);
+                    }
+                    if (key == "getter_condition") {
+                        found |= 0x2;
+                        return from_json_stream(obj.getter_condition, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(RefAlias& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "to") {
+                        found |= 0x4;
+                        return from_json_stream(obj.to, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "hint") {
+                        found |= 0x1;
+                        return from_json_stream(obj.hint, r);
+                    }
+                    if (key == "from") {
+                        found |= 0x2;
+                        return from_json_stream(obj.from, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(RegisterIndex& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 5: {
+                    if (key == "index") {
+                        found |= 0x1;
+                        return from_json_stream(obj.index, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(ReserveData& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "size") {
+                        found |= 0x2;
+                        return from_json_stream(obj.size, r);
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "write_data") {
+                        found |= 0x1;
+                        return from_json_stream(obj.write_data, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(SetEndian& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "endian") {
+                        found |= 0x1;
+                        Endian tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "reserved") {
+                        found |= 0x2;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(Size& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 3: {
+                    if (key == "ref") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.ref(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "unit") {
+                        found |= 0x1;
+                        return from_json_stream(obj.unit, r);
+                    }
+                    if (key == "size") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.size(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(Statement& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(StatementBody& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "kind") {
+                        found |= 0x1;
+                        return from_json_stream(obj.kind, r);
+                    }
+                    if (key == "loop") {
+                        LoopStatement tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.loop(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 5: {
+                    if (key == "block") {
+                        Block tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.block(std::move(tmp)));
+                    }
+                    if (key == "value") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.value(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "break_") {
+                        LoopFlowControl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.break_(std::move(tmp)));
+                    }
+                    if (key == "target") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.target(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "metadata") {
+                        Metadata tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.metadata(std::move(tmp)));
+                    }
+                    if (key == "var_decl") {
+                        VariableDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.var_decl(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "continue_") {
+                        LoopFlowControl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.continue_(std::move(tmp)));
+                    }
+                    if (key == "enum_decl") {
+                        EnumDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.enum_decl(std::move(tmp)));
+                    }
+                    if (key == "func_decl") {
+                        FunctionDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.func_decl(std::move(tmp)));
+                    }
+                    if (key == "read_data") {
+                        IOData tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.read_data(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "expression") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.expression(std::move(tmp)));
+                    }
+                    if (key == "field_decl") {
+                        FieldDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.field_decl(std::move(tmp)));
+                    }
+                    if (key == "init_check") {
+                        InitCheck tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.init_check(std::move(tmp)));
+                    }
+                    if (key == "param_decl") {
+                        ParameterDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.param_decl(std::move(tmp)));
+                    }
+                    if (key == "write_data") {
+                        IOData tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.write_data(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "assert_desc") {
+                        AssertDesc tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.assert_desc(std::move(tmp)));
+                    }
+                    if (key == "import_decl") {
+                        ImportDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.import_decl(std::move(tmp)));
+                    }
+                    if (key == "struct_decl") {
+                        StructDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.struct_decl(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "error_report") {
+                        ErrorReport tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.error_report(std::move(tmp)));
+                    }
+                    if (key == "if_statement") {
+                        IfStatement tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.if_statement(std::move(tmp)));
+                    }
+                    if (key == "length_check") {
+                        LengthCheck tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.length_check(std::move(tmp)));
+                    }
+                    if (key == "match_branch") {
+                        MatchBranch tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.match_branch(std::move(tmp)));
+                    }
+                    if (key == "reserve_data") {
+                        ReserveData tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserve_data(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "property_decl") {
+                        PropertyDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.property_decl(std::move(tmp)));
+                    }
+                    if (key == "related_field") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.related_field(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 14: {
+                    if (key == "endian_convert") {
+                        EndianConvertDesc tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian_convert(std::move(tmp)));
+                    }
+                    if (key == "sub_byte_range") {
+                        SubByteRange tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.sub_byte_range(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "endian_variable") {
+                        EndianVariable tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.endian_variable(std::move(tmp)));
+                    }
+                    if (key == "match_statement") {
+                        MatchStatement tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.match_statement(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "enum_member_decl") {
+                        EnumMemberDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.enum_member_decl(std::move(tmp)));
+                    }
+                    if (key == "related_function") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.related_function(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 19: {
+                    if (key == "previous_assignment") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.previous_assignment(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 20: {
+                    if (key == "composite_field_decl") {
+                        CompositeFieldDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.composite_field_decl(std::move(tmp)));
+                    }
+                    if (key == "property_member_decl") {
+                        PropertyMemberDecl tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.property_member_decl(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 21: {
+                    if (key == "lowered_io_statements") {
+                        LoweredIOStatements tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.lowered_io_statements(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(StatementRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = StatementRef{id};
+        return true;
+    }
+    
+    bool from_json_stream(String& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "data") {
+                        found |= 0x2;
+                        return from_json_stream(obj.data, r);
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "length") {
+                        found |= 0x1;
+                        return from_json_stream(obj.length, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(StringLiteral& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(StringRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = StringRef{id};
+        return true;
+    }
+    
+    bool from_json_stream(StructDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    if (key == "size") {
+                        Size tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.size(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "fields") {
+                        found |= 0x2;
+                        return from_json_stream(obj.fields, r);
+                    }
+                    break;
+                }
+                case 7: {
+                    if (key == "methods") {
+                        Block tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.methods(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "decode_fn") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.decode_fn(std::move(tmp)));
+                    }
+                    if (key == "encode_fn") {
+                        StatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.encode_fn(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "has_parent") {
+                        found |= 0x100;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_parent(std::move(tmp));
+                        return true;
+                    }
+                    if (key == "properties") {
+                        Block tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.properties(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "is_recursive") {
+                        found |= 0x4;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_recursive(std::move(tmp));
+                        return true;
+                    }
+                    if (key == "nested_types") {
+                        Block tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.nested_types(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "is_fixed_size") {
+                        found |= 0x8;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_fixed_size(std::move(tmp));
+                        return true;
+                    }
+                    if (key == "has_functions") {
+                        found |= 0x40;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_functions(std::move(tmp));
+                        return true;
+                    }
+                    if (key == "parent_struct") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.parent_struct(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 14: {
+                    if (key == "has_properties") {
+                        found |= 0x80;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_properties(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 15: {
+                    if (key == "related_variant") {
+                        TypeRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.related_variant(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "has_nested_types") {
+                        found |= 0x200;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_nested_types(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 17: {
+                    if (key == "has_encode_decode") {
+                        found |= 0x20;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_encode_decode(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 19: {
+                    if (key == "has_related_variant") {
+                        found |= 0x10;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.has_related_variant(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3ff) == 0x3ff;
+    }
+    
+    bool from_json_stream(SubByteRange& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 6: {
+                    if (key == "length") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.length(std::move(tmp)));
+                    }
+                    if (key == "offset") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.offset(std::move(tmp)));
+                    }
+                    if (key == "io_ref") {
+                        found |= 0x4;
+                        return from_json_stream(obj.io_ref, r);
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "range_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.range_type, r);
+                    }
+                    if (key == "expression") {
+                        ExpressionRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.expression(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "stream_type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.stream_type, r);
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "io_statement") {
+                        found |= 0x10;
+                        return from_json_stream(obj.io_statement, r);
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "parent_io_ref") {
+                        found |= 0x8;
+                        return from_json_stream(obj.parent_io_ref, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1f) == 0x1f;
+    }
+    
+    bool from_json_stream(Type& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "body") {
+                        found |= 0x2;
+                        return from_json_stream(obj.body, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(TypeBody& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.id(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 4: {
+                    if (key == "kind") {
+                        found |= 0x1;
+                        return from_json_stream(obj.kind, r);
+                    }
+                    if (key == "size") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.size(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 6: {
+                    if (key == "length") {
+                        Varint tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.length(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "base_type") {
+                        TypeRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.base_type(std::move(tmp)));
+                    }
+                    if (key == "func_desc") {
+                        FuncTypeDesc tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.func_desc(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 10: {
+                    if (key == "inner_type") {
+                        TypeRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.inner_type(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "element_type") {
+                        TypeRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.element_type(std::move(tmp)));
+                    }
+                    if (key == "pointee_type") {
+                        TypeRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.pointee_type(std::move(tmp)));
+                    }
+                    if (key == "variant_desc") {
+                        VariantDesc tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.variant_desc(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 16: {
+                    if (key == "array_annotation") {
+                        ArrayAnnotation tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.array_annotation(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(TypeCastDesc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 9: {
+                    if (key == "from_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.from_type, r);
+                    }
+                    if (key == "cast_kind") {
+                        found |= 0x4;
+                        return from_json_stream(obj.cast_kind, r);
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "source_expr") {
+                        found |= 0x1;
+                        return from_json_stream(obj.source_expr, r);
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "cast_function") {
+                        WeakStatementRef tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.cast_function(std::move(tmp)));
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(TypeRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = TypeRef{id};
+        return true;
+    }
+    
+    bool from_json_stream(Types& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 3: {
+                    if (key == "len") {
+                        found |= 0x1;
+                        return from_json_stream(obj.len, r);
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "container") {
+                        found |= 0x2;
+                        return from_json_stream(obj.container, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3) == 0x3;
+    }
+    
+    bool from_json_stream(VariableDecl& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 4: {
+                    if (key == "name") {
+                        found |= 0x1;
+                        return from_json_stream(obj.name, r);
+                    }
+                    break;
+                }
+                case 8: {
+                    if (key == "var_type") {
+                        found |= 0x2;
+                        return from_json_stream(obj.var_type, r);
+                    }
+                    if (key == "reserved") {
+                        found |= 0x20;
+                        std::uint8_t tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.reserved(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 9: {
+                    if (key == "decl_kind") {
+                        found |= 0x8;
+                        VariableDeclKind tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        return bool(obj.decl_kind(std::move(tmp)));
+                    }
+                    break;
+                }
+                case 12: {
+                    if (key == "is_reference") {
+                        found |= 0x10;
+                        bool tmp;
+                        if (!from_json_stream(tmp, r)) {
+                            return false;
+                        }
+                        obj.is_reference(std::move(tmp));
+                        return true;
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "initial_value") {
+                        found |= 0x4;
+                        return from_json_stream(obj.initial_value, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x3f) == 0x3f;
+    }
+    
+    bool from_json_stream(VariantDesc& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 7: {
+                    if (key == "members") {
+                        found |= 0x2;
+                        return from_json_stream(obj.members, r);
+                    }
+                    break;
+                }
+                case 11: {
+                    if (key == "common_type") {
+                        found |= 0x1;
+                        return from_json_stream(obj.common_type, r);
+                    }
+                    break;
+                }
+                case 13: {
+                    if (key == "related_field") {
+                        found |= 0x4;
+                        return from_json_stream(obj.related_field, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x7) == 0x7;
+    }
+    
+    bool from_json_stream(Varint& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t id;
+        if (!r.read_uint(id)) {
+            return false;
+        }
+        obj = Varint{id};
+        return true;
+    }
+    
+    bool from_json_stream(WeakStatementRef& obj, ::ebmgen::JSONStreamReader& r) {
+        std::uint64_t found = 0;
+        auto ok = r.read_object([&](std::string_view key) {
+            switch (key.size()) {
+                case 2: {
+                    if (key == "id") {
+                        found |= 0x1;
+                        return from_json_stream(obj.id, r);
+                    }
+                    break;
+                }
+            }
+            return r.skip_value();
+        });
+        return ok && (found & 0x1) == 0x1;
+    }
+    
+    bool from_json_stream(AliasHint& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 4: {
+                if (s == "TYPE") {
+                    obj = AliasHint::TYPE;
+                    return true;
+                }
+                break;
+            }
+            case 5: {
+                if (s == "ALIAS") {
+                    obj = AliasHint::ALIAS;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "STRING") {
+                    obj = AliasHint::STRING;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "STATEMENT") {
+                    obj = AliasHint::STATEMENT;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "IDENTIFIER") {
+                    obj = AliasHint::IDENTIFIER;
+                    return true;
+                }
+                if (s == "EXPRESSION") {
+                    obj = AliasHint::EXPRESSION;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(ArrayAnnotation& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 4: {
+                if (s == "none") {
+                    obj = ArrayAnnotation::none;
+                    return true;
+                }
+                break;
+            }
+            case 14: {
+                if (s == "read_temporary") {
+                    obj = ArrayAnnotation::read_temporary;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "write_temporary") {
+                    obj = ArrayAnnotation::write_temporary;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(BinaryOp& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 3: {
+                if (s == "mul") {
+                    obj = BinaryOp::mul;
+                    return true;
+                }
+                if (s == "div") {
+                    obj = BinaryOp::div;
+                    return true;
+                }
+                if (s == "mod") {
+                    obj = BinaryOp::mod;
+                    return true;
+                }
+                if (s == "add") {
+                    obj = BinaryOp::add;
+                    return true;
+                }
+                if (s == "sub") {
+                    obj = BinaryOp::sub;
+                    return true;
+                }
+                break;
+            }
+            case 4: {
+                if (s == "less") {
+                    obj = BinaryOp::less;
+                    return true;
+                }
+                break;
+            }
+            case 5: {
+                if (s == "equal") {
+                    obj = BinaryOp::equal;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "bit_or") {
+                    obj = BinaryOp::bit_or;
+                    return true;
+                }
+                break;
+            }
+            case 7: {
+                if (s == "bit_and") {
+                    obj = BinaryOp::bit_and;
+                    return true;
+                }
+                if (s == "bit_xor") {
+                    obj = BinaryOp::bit_xor;
+                    return true;
+                }
+                if (s == "greater") {
+                    obj = BinaryOp::greater;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "not_equal") {
+                    obj = BinaryOp::not_equal;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "left_shift") {
+                    obj = BinaryOp::left_shift;
+                    return true;
+                }
+                if (s == "less_or_eq") {
+                    obj = BinaryOp::less_or_eq;
+                    return true;
+                }
+                if (s == "logical_or") {
+                    obj = BinaryOp::logical_or;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "right_shift") {
+                    obj = BinaryOp::right_shift;
+                    return true;
+                }
+                if (s == "logical_and") {
+                    obj = BinaryOp::logical_and;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "greater_or_eq") {
+                    obj = BinaryOp::greater_or_eq;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(CastType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 5: {
+                if (s == "OTHER") {
+                    obj = CastType::OTHER;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "ENUM_TO_INT") {
+                    obj = CastType::ENUM_TO_INT;
+                    return true;
+                }
+                if (s == "INT_TO_ENUM") {
+                    obj = CastType::INT_TO_ENUM;
+                    return true;
+                }
+                if (s == "BOOL_TO_INT") {
+                    obj = CastType::BOOL_TO_INT;
+                    return true;
+                }
+                if (s == "INT_TO_BOOL") {
+                    obj = CastType::INT_TO_BOOL;
+                    return true;
+                }
+                break;
+            }
+            case 12: {
+                if (s == "USIZE_TO_INT") {
+                    obj = CastType::USIZE_TO_INT;
+                    return true;
+                }
+                if (s == "INT_TO_USIZE") {
+                    obj = CastType::INT_TO_USIZE;
+                    return true;
+                }
+                if (s == "INT_TO_ARRAY") {
+                    obj = CastType::INT_TO_ARRAY;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "INT_TO_VECTOR") {
+                    obj = CastType::INT_TO_VECTOR;
+                    return true;
+                }
+                if (s == "FUNCTION_CAST") {
+                    obj = CastType::FUNCTION_CAST;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "VECTOR_TO_ARRAY") {
+                    obj = CastType::VECTOR_TO_ARRAY;
+                    return true;
+                }
+                if (s == "ARRAY_TO_VECTOR") {
+                    obj = CastType::ARRAY_TO_VECTOR;
+                    return true;
+                }
+                break;
+            }
+            case 16: {
+                if (s == "FLOAT_TO_INT_BIT") {
+                    obj = CastType::FLOAT_TO_INT_BIT;
+                    return true;
+                }
+                if (s == "INT_TO_FLOAT_BIT") {
+                    obj = CastType::INT_TO_FLOAT_BIT;
+                    return true;
+                }
+                break;
+            }
+            case 18: {
+                if (s == "SIGNED_TO_UNSIGNED") {
+                    obj = CastType::SIGNED_TO_UNSIGNED;
+                    return true;
+                }
+                if (s == "UNSIGNED_TO_SIGNED") {
+                    obj = CastType::UNSIGNED_TO_SIGNED;
+                    return true;
+                }
+                break;
+            }
+            case 22: {
+                if (s == "SMALL_INT_TO_LARGE_INT") {
+                    obj = CastType::SMALL_INT_TO_LARGE_INT;
+                    return true;
+                }
+                if (s == "LARGE_INT_TO_SMALL_INT") {
+                    obj = CastType::LARGE_INT_TO_SMALL_INT;
+                    return true;
+                }
+                break;
+            }
+            case 26: {
+                if (s == "STRUCT_TO_RECURSIVE_STRUCT") {
+                    obj = CastType::STRUCT_TO_RECURSIVE_STRUCT;
+                    return true;
+                }
+                if (s == "RECURSIVE_STRUCT_TO_STRUCT") {
+                    obj = CastType::RECURSIVE_STRUCT_TO_STRUCT;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(CompositeFieldKind& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 14: {
+                if (s == "BULK_PRIMITIVE") {
+                    obj = CompositeFieldKind::BULK_PRIMITIVE;
+                    return true;
+                }
+                if (s == "BULK_COMPOSITE") {
+                    obj = CompositeFieldKind::BULK_COMPOSITE;
+                    return true;
+                }
+                break;
+            }
+            case 24: {
+                if (s == "PREFIXED_UNION_PRIMITIVE") {
+                    obj = CompositeFieldKind::PREFIXED_UNION_PRIMITIVE;
+                    return true;
+                }
+                if (s == "PREFIXED_UNION_COMPOSITE") {
+                    obj = CompositeFieldKind::PREFIXED_UNION_COMPOSITE;
+                    return true;
+                }
+                break;
+            }
+            case 26: {
+                if (s == "SANDWICHED_UNION_PRIMITIVE") {
+                    obj = CompositeFieldKind::SANDWICHED_UNION_PRIMITIVE;
+                    return true;
+                }
+                if (s == "SANDWICHED_UNION_COMPOSITE") {
+                    obj = CompositeFieldKind::SANDWICHED_UNION_COMPOSITE;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(Endian& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 3: {
+                if (s == "big") {
+                    obj = Endian::big;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "unspec") {
+                    obj = Endian::unspec;
+                    return true;
+                }
+                if (s == "little") {
+                    obj = Endian::little;
+                    return true;
+                }
+                if (s == "native") {
+                    obj = Endian::native;
+                    return true;
+                }
+                break;
+            }
+            case 7: {
+                if (s == "dynamic") {
+                    obj = Endian::dynamic;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(ExpressionKind& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 4: {
+                if (s == "CALL") {
+                    obj = ExpressionKind::CALL;
+                    return true;
+                }
+                if (s == "SELF") {
+                    obj = ExpressionKind::SELF;
+                    return true;
+                }
+                break;
+            }
+            case 5: {
+                if (s == "RANGE") {
+                    obj = ExpressionKind::RANGE;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "SIZEOF") {
+                    obj = ExpressionKind::SIZEOF;
+                    return true;
+                }
+                if (s == "AS_ARG") {
+                    obj = ExpressionKind::AS_ARG;
+                    return true;
+                }
+                break;
+            }
+            case 7: {
+                if (s == "OR_COND") {
+                    obj = ExpressionKind::OR_COND;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "UNARY_OP") {
+                    obj = ExpressionKind::UNARY_OP;
+                    return true;
+                }
+                if (s == "IS_ERROR") {
+                    obj = ExpressionKind::IS_ERROR;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "BINARY_OP") {
+                    obj = ExpressionKind::BINARY_OP;
+                    return true;
+                }
+                if (s == "TYPE_CAST") {
+                    obj = ExpressionKind::TYPE_CAST;
+                    return true;
+                }
+                if (s == "MAX_VALUE") {
+                    obj = ExpressionKind::MAX_VALUE;
+                    return true;
+                }
+                if (s == "READ_DATA") {
+                    obj = ExpressionKind::READ_DATA;
+                    return true;
+                }
+                if (s == "AVAILABLE") {
+                    obj = ExpressionKind::AVAILABLE;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "IDENTIFIER") {
+                    obj = ExpressionKind::IDENTIFIER;
+                    return true;
+                }
+                if (s == "ARRAY_SIZE") {
+                    obj = ExpressionKind::ARRAY_SIZE;
+                    return true;
+                }
+                if (s == "WRITE_DATA") {
+                    obj = ExpressionKind::WRITE_DATA;
+                    return true;
+                }
+                if (s == "ADDRESS_OF") {
+                    obj = ExpressionKind::ADDRESS_OF;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "LITERAL_INT") {
+                    obj = ExpressionKind::LITERAL_INT;
+                    return true;
+                }
+                if (s == "ENUM_MEMBER") {
+                    obj = ExpressionKind::ENUM_MEMBER;
+                    return true;
+                }
+                if (s == "CONDITIONAL") {
+                    obj = ExpressionKind::CONDITIONAL;
+                    return true;
+                }
+                if (s == "OPTIONAL_OF") {
+                    obj = ExpressionKind::OPTIONAL_OF;
+                    return true;
+                }
+                break;
+            }
+            case 12: {
+                if (s == "LITERAL_BOOL") {
+                    obj = ExpressionKind::LITERAL_BOOL;
+                    return true;
+                }
+                if (s == "LITERAL_TYPE") {
+                    obj = ExpressionKind::LITERAL_TYPE;
+                    return true;
+                }
+                if (s == "LITERAL_CHAR") {
+                    obj = ExpressionKind::LITERAL_CHAR;
+                    return true;
+                }
+                if (s == "INDEX_ACCESS") {
+                    obj = ExpressionKind::INDEX_ACCESS;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "LITERAL_INT64") {
+                    obj = ExpressionKind::LITERAL_INT64;
+                    return true;
+                }
+                if (s == "MEMBER_ACCESS") {
+                    obj = ExpressionKind::MEMBER_ACCESS;
+                    return true;
+                }
+                if (s == "DEFAULT_VALUE") {
+                    obj = ExpressionKind::DEFAULT_VALUE;
+                    return true;
+                }
+                if (s == "SETTER_STATUS") {
+                    obj = ExpressionKind::SETTER_STATUS;
+                    return true;
+                }
+                break;
+            }
+            case 14: {
+                if (s == "LITERAL_STRING") {
+                    obj = ExpressionKind::LITERAL_STRING;
+                    return true;
+                }
+                if (s == "SUB_RANGE_INIT") {
+                    obj = ExpressionKind::SUB_RANGE_INIT;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "CAN_READ_STREAM") {
+                    obj = ExpressionKind::CAN_READ_STREAM;
+                    return true;
+                }
+                if (s == "ENUM_IS_DEFINED") {
+                    obj = ExpressionKind::ENUM_IS_DEFINED;
+                    return true;
+                }
+                break;
+            }
+            case 16: {
+                if (s == "IS_LITTLE_ENDIAN") {
+                    obj = ExpressionKind::IS_LITTLE_ENDIAN;
+                    return true;
+                }
+                break;
+            }
+            case 17: {
+                if (s == "GET_STREAM_OFFSET") {
+                    obj = ExpressionKind::GET_STREAM_OFFSET;
+                    return true;
+                }
+                break;
+            }
+            case 19: {
+                if (s == "GET_REMAINING_BYTES") {
+                    obj = ExpressionKind::GET_REMAINING_BYTES;
+                    return true;
+                }
+                break;
+            }
+            case 21: {
+                if (s == "CONDITIONAL_STATEMENT") {
+                    obj = ExpressionKind::CONDITIONAL_STATEMENT;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(FuncTypeAnnotation& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 6: {
+                if (s == "NORMAL") {
+                    obj = FuncTypeAnnotation::NORMAL;
+                    return true;
+                }
+                if (s == "METHOD") {
+                    obj = FuncTypeAnnotation::METHOD;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "FUNC_PTR") {
+                    obj = FuncTypeAnnotation::FUNC_PTR;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(FunctionKind& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 4: {
+                if (s == "CAST") {
+                    obj = FunctionKind::CAST;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "NORMAL") {
+                    obj = FunctionKind::NORMAL;
+                    return true;
+                }
+                if (s == "METHOD") {
+                    obj = FunctionKind::METHOD;
+                    return true;
+                }
+                if (s == "ENCODE") {
+                    obj = FunctionKind::ENCODE;
+                    return true;
+                }
+                if (s == "DECODE") {
+                    obj = FunctionKind::DECODE;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "VECTOR_SETTER") {
+                    obj = FunctionKind::VECTOR_SETTER;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "PROPERTY_GETTER") {
+                    obj = FunctionKind::PROPERTY_GETTER;
+                    return true;
+                }
+                if (s == "PROPERTY_SETTER") {
+                    obj = FunctionKind::PROPERTY_SETTER;
+                    return true;
+                }
+                break;
+            }
+            case 16: {
+                if (s == "COMPOSITE_GETTER") {
+                    obj = FunctionKind::COMPOSITE_GETTER;
+                    return true;
+                }
+                if (s == "COMPOSITE_SETTER") {
+                    obj = FunctionKind::COMPOSITE_SETTER;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(InitCheckType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 9: {
+                if (s == "union_get") {
+                    obj = InitCheckType::union_get;
+                    return true;
+                }
+                if (s == "union_set") {
+                    obj = InitCheckType::union_set;
+                    return true;
+                }
+                break;
+            }
+            case 17: {
+                if (s == "union_init_encode") {
+                    obj = InitCheckType::union_init_encode;
+                    return true;
+                }
+                if (s == "union_init_decode") {
+                    obj = InitCheckType::union_init_decode;
+                    return true;
+                }
+                if (s == "field_init_encode") {
+                    obj = InitCheckType::field_init_encode;
+                    return true;
+                }
+                if (s == "field_init_decode") {
+                    obj = InitCheckType::field_init_decode;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(LengthCheckType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 20: {
+                if (s == "ENCODE_VECTOR_LENGTH") {
+                    obj = LengthCheckType::ENCODE_VECTOR_LENGTH;
+                    return true;
+                }
+                if (s == "SETTER_VECTOR_LENGTH") {
+                    obj = LengthCheckType::SETTER_VECTOR_LENGTH;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(LoopType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 3: {
+                if (s == "FOR") {
+                    obj = LoopType::FOR;
+                    return true;
+                }
+                break;
+            }
+            case 5: {
+                if (s == "WHILE") {
+                    obj = LoopType::WHILE;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "INFINITE") {
+                    obj = LoopType::INFINITE;
+                    return true;
+                }
+                if (s == "FOR_EACH") {
+                    obj = LoopType::FOR_EACH;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(LoweringIOType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 11: {
+                if (s == "STRUCT_CALL") {
+                    obj = LoweringIOType::STRUCT_CALL;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "VECTORIZED_IO") {
+                    obj = LoweringIOType::VECTORIZED_IO;
+                    return true;
+                }
+                break;
+            }
+            case 14: {
+                if (s == "ARRAY_FOR_EACH") {
+                    obj = LoweringIOType::ARRAY_FOR_EACH;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "STRING_FOR_EACH") {
+                    obj = LoweringIOType::STRING_FOR_EACH;
+                    return true;
+                }
+                break;
+            }
+            case 17: {
+                if (s == "INT_TO_BYTE_ARRAY") {
+                    obj = LoweringIOType::INT_TO_BYTE_ARRAY;
+                    return true;
+                }
+                break;
+            }
+            case 19: {
+                if (s == "FLOAT_TO_BYTE_ARRAY") {
+                    obj = LoweringIOType::FLOAT_TO_BYTE_ARRAY;
+                    return true;
+                }
+                if (s == "FIXED_LAYOUT_DECODE") {
+                    obj = LoweringIOType::FIXED_LAYOUT_DECODE;
+                    return true;
+                }
+                break;
+            }
+            case 20: {
+                if (s == "MULTI_REPRESENTATION") {
+                    obj = LoweringIOType::MULTI_REPRESENTATION;
+                    return true;
+                }
+                if (s == "BULK_PRIMITIVE_ARRAY") {
+                    obj = LoweringIOType::BULK_PRIMITIVE_ARRAY;
+                    return true;
+                }
+                break;
+            }
+            case 22: {
+                if (s == "ENUM_UNDERLYING_TO_INT") {
+                    obj = LoweringIOType::ENUM_UNDERLYING_TO_INT;
+                    return true;
+                }
+                if (s == "BIT_FIELD_TO_BIT_SHIFT") {
+                    obj = LoweringIOType::BIT_FIELD_TO_BIT_SHIFT;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(MergeMode& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 11: {
+                if (s == "COMMON_TYPE") {
+                    obj = MergeMode::COMMON_TYPE;
+                    return true;
+                }
+                if (s == "STRICT_TYPE") {
+                    obj = MergeMode::STRICT_TYPE;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "UNCOMMON_TYPE") {
+                    obj = MergeMode::UNCOMMON_TYPE;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(OpCode& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 2: {
+                if (s == "EQ") {
+                    obj = OpCode::EQ;
+                    return true;
+                }
+                if (s == "LT") {
+                    obj = OpCode::LT;
+                    return true;
+                }
+                if (s == "LE") {
+                    obj = OpCode::LE;
+                    return true;
+                }
+                if (s == "GT") {
+                    obj = OpCode::GT;
+                    return true;
+                }
+                if (s == "GE") {
+                    obj = OpCode::GE;
+                    return true;
+                }
+                break;
+            }
+            case 3: {
+                if (s == "NOP") {
+                    obj = OpCode::NOP;
+                    return true;
+                }
+                if (s == "RET") {
+                    obj = OpCode::RET;
+                    return true;
+                }
+                if (s == "POP") {
+                    obj = OpCode::POP;
+                    return true;
+                }
+                if (s == "DUP") {
+                    obj = OpCode::DUP;
+                    return true;
+                }
+                if (s == "ADD") {
+                    obj = OpCode::ADD;
+                    return true;
+                }
+                if (s == "SUB") {
+                    obj = OpCode::SUB;
+                    return true;
+                }
+                if (s == "MUL") {
+                    obj = OpCode::MUL;
+                    return true;
+                }
+                if (s == "DIV") {
+                    obj = OpCode::DIV;
+                    return true;
+                }
+                if (s == "MOD") {
+                    obj = OpCode::MOD;
+                    return true;
+                }
+                if (s == "NEG") {
+                    obj = OpCode::NEG;
+                    return true;
+                }
+                if (s == "NEQ") {
+                    obj = OpCode::NEQ;
+                    return true;
+                }
+                break;
+            }
+            case 4: {
+                if (s == "HALT") {
+                    obj = OpCode::HALT;
+                    return true;
+                }
+                if (s == "JUMP") {
+                    obj = OpCode::JUMP;
+                    return true;
+                }
+                if (s == "CALL") {
+                    obj = OpCode::CALL;
+                    return true;
+                }
+                if (s == "SWAP") {
+                    obj = OpCode::SWAP;
+                    return true;
+                }
+                if (s == "CAST") {
+                    obj = OpCode::CAST;
+                    return true;
+                }
+                break;
+            }
+            case 5: {
+                if (s == "ERROR") {
+                    obj = OpCode::ERROR;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "ASSERT") {
+                    obj = OpCode::ASSERT;
+                    return true;
+                }
+                if (s == "BIT_OR") {
+                    obj = OpCode::BIT_OR;
+                    return true;
+                }
+                if (s == "LSHIFT") {
+                    obj = OpCode::LSHIFT;
+                    return true;
+                }
+                if (s == "RSHIFT") {
+                    obj = OpCode::RSHIFT;
+                    return true;
+                }
+                break;
+            }
+            case 7: {
+                if (s == "BIT_AND") {
+                    obj = OpCode::BIT_AND;
+                    return true;
+                }
+                if (s == "BIT_XOR") {
+                    obj = OpCode::BIT_XOR;
+                    return true;
+                }
+                if (s == "BIT_NOT") {
+                    obj = OpCode::BIT_NOT;
+                    return true;
+                }
+                if (s == "READ_U8") {
+                    obj = OpCode::READ_U8;
+                    return true;
+                }
+                if (s == "READ_I8") {
+                    obj = OpCode::READ_I8;
+                    return true;
+                }
+                if (s == "PEEK_U8") {
+                    obj = OpCode::PEEK_U8;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "IS_ERROR") {
+                    obj = OpCode::IS_ERROR;
+                    return true;
+                }
+                if (s == "READ_U16") {
+                    obj = OpCode::READ_U16;
+                    return true;
+                }
+                if (s == "READ_U32") {
+                    obj = OpCode::READ_U32;
+                    return true;
+                }
+                if (s == "READ_U64") {
+                    obj = OpCode::READ_U64;
+                    return true;
+                }
+                if (s == "READ_I16") {
+                    obj = OpCode::READ_I16;
+                    return true;
+                }
+                if (s == "READ_I32") {
+                    obj = OpCode::READ_I32;
+                    return true;
+                }
+                if (s == "READ_I64") {
+                    obj = OpCode::READ_I64;
+                    return true;
+                }
+                if (s == "READ_F32") {
+                    obj = OpCode::READ_F32;
+                    return true;
+                }
+                if (s == "READ_F64") {
+                    obj = OpCode::READ_F64;
+                    return true;
+                }
+                if (s == "SEEK_REL") {
+                    obj = OpCode::SEEK_REL;
+                    return true;
+                }
+                if (s == "SEEK_ABS") {
+                    obj = OpCode::SEEK_ABS;
+                    return true;
+                }
+                if (s == "WRITE_U8") {
+                    obj = OpCode::WRITE_U8;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "PUSH_NULL") {
+                    obj = OpCode::PUSH_NULL;
+                    return true;
+                }
+                if (s == "LOAD_SELF") {
+                    obj = OpCode::LOAD_SELF;
+                    return true;
+                }
+                if (s == "STORE_REF") {
+                    obj = OpCode::STORE_REF;
+                    return true;
+                }
+                if (s == "AVAILABLE") {
+                    obj = OpCode::AVAILABLE;
+                    return true;
+                }
+                if (s == "WRITE_U16") {
+                    obj = OpCode::WRITE_U16;
+                    return true;
+                }
+                if (s == "WRITE_U32") {
+                    obj = OpCode::WRITE_U32;
+                    return true;
+                }
+                if (s == "WRITE_U64") {
+                    obj = OpCode::WRITE_U64;
+                    return true;
+                }
+                if (s == "NEW_ARRAY") {
+                    obj = OpCode::NEW_ARRAY;
+                    return true;
+                }
+                if (s == "ARRAY_SET") {
+                    obj = OpCode::ARRAY_SET;
+                    return true;
+                }
+                if (s == "ARRAY_GET") {
+                    obj = OpCode::ARRAY_GET;
+                    return true;
+                }
+                if (s == "ARRAY_LEN") {
+                    obj = OpCode::ARRAY_LEN;
+                    return true;
+                }
+                if (s == "NEW_BYTES") {
+                    obj = OpCode::NEW_BYTES;
+                    return true;
+                }
+                if (s == "LOAD_FUNC") {
+                    obj = OpCode::LOAD_FUNC;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "LOAD_LOCAL") {
+                    obj = OpCode::LOAD_LOCAL;
+                    return true;
+                }
+                if (s == "LOAD_PARAM") {
+                    obj = OpCode::LOAD_PARAM;
+                    return true;
+                }
+                if (s == "LOGICAL_OR") {
+                    obj = OpCode::LOGICAL_OR;
+                    return true;
+                }
+                if (s == "READ_BYTES") {
+                    obj = OpCode::READ_BYTES;
+                    return true;
+                }
+                if (s == "GET_OFFSET") {
+                    obj = OpCode::GET_OFFSET;
+                    return true;
+                }
+                if (s == "SET_ENDIAN") {
+                    obj = OpCode::SET_ENDIAN;
+                    return true;
+                }
+                if (s == "WRITE_BITS") {
+                    obj = OpCode::WRITE_BITS;
+                    return true;
+                }
+                if (s == "NEW_STRUCT") {
+                    obj = OpCode::NEW_STRUCT;
+                    return true;
+                }
+                if (s == "MAX_OPCODE") {
+                    obj = OpCode::MAX_OPCODE;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "STORE_LOCAL") {
+                    obj = OpCode::STORE_LOCAL;
+                    return true;
+                }
+                if (s == "LOGICAL_AND") {
+                    obj = OpCode::LOGICAL_AND;
+                    return true;
+                }
+                if (s == "LOGICAL_NOT") {
+                    obj = OpCode::LOGICAL_NOT;
+                    return true;
+                }
+                if (s == "READ_BITS_U") {
+                    obj = OpCode::READ_BITS_U;
+                    return true;
+                }
+                if (s == "READ_BITS_I") {
+                    obj = OpCode::READ_BITS_I;
+                    return true;
+                }
+                if (s == "WRITE_BYTES") {
+                    obj = OpCode::WRITE_BYTES;
+                    return true;
+                }
+                if (s == "LOAD_MEMBER") {
+                    obj = OpCode::LOAD_MEMBER;
+                    return true;
+                }
+                if (s == "VECTOR_PUSH") {
+                    obj = OpCode::VECTOR_PUSH;
+                    return true;
+                }
+                if (s == "CALL_GETTER") {
+                    obj = OpCode::CALL_GETTER;
+                    return true;
+                }
+                break;
+            }
+            case 12: {
+                if (s == "JUMP_IF_TRUE") {
+                    obj = OpCode::JUMP_IF_TRUE;
+                    return true;
+                }
+                if (s == "PUSH_IMM_INT") {
+                    obj = OpCode::PUSH_IMM_INT;
+                    return true;
+                }
+                if (s == "PUSH_IMM_STR") {
+                    obj = OpCode::PUSH_IMM_STR;
+                    return true;
+                }
+                if (s == "PUSH_SUCCESS") {
+                    obj = OpCode::PUSH_SUCCESS;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "JUMP_IF_FALSE") {
+                    obj = OpCode::JUMP_IF_FALSE;
+                    return true;
+                }
+                break;
+            }
+            case 14: {
+                if (s == "LOAD_LOCAL_REF") {
+                    obj = OpCode::LOAD_LOCAL_REF;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "LOAD_MEMBER_REF") {
+                    obj = OpCode::LOAD_MEMBER_REF;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(SetterStatus& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 6: {
+                if (s == "FAILED") {
+                    obj = SetterStatus::FAILED;
+                    return true;
+                }
+                break;
+            }
+            case 7: {
+                if (s == "SUCCESS") {
+                    obj = SetterStatus::SUCCESS;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(SizeUnit& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 7: {
+                if (s == "UNKNOWN") {
+                    obj = SizeUnit::UNKNOWN;
+                    return true;
+                }
+                if (s == "DYNAMIC") {
+                    obj = SizeUnit::DYNAMIC;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "BIT_FIXED") {
+                    obj = SizeUnit::BIT_FIXED;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "BYTE_FIXED") {
+                    obj = SizeUnit::BYTE_FIXED;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "BIT_DYNAMIC") {
+                    obj = SizeUnit::BIT_DYNAMIC;
+                    return true;
+                }
+                break;
+            }
+            case 12: {
+                if (s == "BYTE_DYNAMIC") {
+                    obj = SizeUnit::BYTE_DYNAMIC;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "ELEMENT_FIXED") {
+                    obj = SizeUnit::ELEMENT_FIXED;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "ELEMENT_DYNAMIC") {
+                    obj = SizeUnit::ELEMENT_DYNAMIC;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(StatementKind& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 5: {
+                if (s == "BLOCK") {
+                    obj = StatementKind::BLOCK;
+                    return true;
+                }
+                if (s == "YIELD") {
+                    obj = StatementKind::YIELD;
+                    return true;
+                }
+                if (s == "BREAK") {
+                    obj = StatementKind::BREAK;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "APPEND") {
+                    obj = StatementKind::APPEND;
+                    return true;
+                }
+                if (s == "RETURN") {
+                    obj = StatementKind::RETURN;
+                    return true;
+                }
+                if (s == "ASSERT") {
+                    obj = StatementKind::ASSERT;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "CONTINUE") {
+                    obj = StatementKind::CONTINUE;
+                    return true;
+                }
+                if (s == "METADATA") {
+                    obj = StatementKind::METADATA;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "READ_DATA") {
+                    obj = StatementKind::READ_DATA;
+                    return true;
+                }
+                if (s == "ENUM_DECL") {
+                    obj = StatementKind::ENUM_DECL;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "ASSIGNMENT") {
+                    obj = StatementKind::ASSIGNMENT;
+                    return true;
+                }
+                if (s == "WRITE_DATA") {
+                    obj = StatementKind::WRITE_DATA;
+                    return true;
+                }
+                if (s == "FIELD_DECL") {
+                    obj = StatementKind::FIELD_DECL;
+                    return true;
+                }
+                if (s == "UNION_DECL") {
+                    obj = StatementKind::UNION_DECL;
+                    return true;
+                }
+                if (s == "EXPRESSION") {
+                    obj = StatementKind::EXPRESSION;
+                    return true;
+                }
+                if (s == "INIT_CHECK") {
+                    obj = StatementKind::INIT_CHECK;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "STRUCT_DECL") {
+                    obj = StatementKind::STRUCT_DECL;
+                    return true;
+                }
+                break;
+            }
+            case 12: {
+                if (s == "ERROR_RETURN") {
+                    obj = StatementKind::ERROR_RETURN;
+                    return true;
+                }
+                if (s == "RESERVE_DATA") {
+                    obj = StatementKind::RESERVE_DATA;
+                    return true;
+                }
+                if (s == "IF_STATEMENT") {
+                    obj = StatementKind::IF_STATEMENT;
+                    return true;
+                }
+                if (s == "MATCH_BRANCH") {
+                    obj = StatementKind::MATCH_BRANCH;
+                    return true;
+                }
+                if (s == "PROGRAM_DECL") {
+                    obj = StatementKind::PROGRAM_DECL;
+                    return true;
+                }
+                if (s == "ERROR_REPORT") {
+                    obj = StatementKind::ERROR_REPORT;
+                    return true;
+                }
+                if (s == "ARRAY_TO_INT") {
+                    obj = StatementKind::ARRAY_TO_INT;
+                    return true;
+                }
+                if (s == "INT_TO_ARRAY") {
+                    obj = StatementKind::INT_TO_ARRAY;
+                    return true;
+                }
+                if (s == "LENGTH_CHECK") {
+                    obj = StatementKind::LENGTH_CHECK;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "FUNCTION_DECL") {
+                    obj = StatementKind::FUNCTION_DECL;
+                    return true;
+                }
+                if (s == "VARIABLE_DECL") {
+                    obj = StatementKind::VARIABLE_DECL;
+                    return true;
+                }
+                if (s == "PROPERTY_DECL") {
+                    obj = StatementKind::PROPERTY_DECL;
+                    return true;
+                }
+                if (s == "IMPORT_MODULE") {
+                    obj = StatementKind::IMPORT_MODULE;
+                    return true;
+                }
+                break;
+            }
+            case 14: {
+                if (s == "LOOP_STATEMENT") {
+                    obj = StatementKind::LOOP_STATEMENT;
+                    return true;
+                }
+                if (s == "PARAMETER_DECL") {
+                    obj = StatementKind::PARAMETER_DECL;
+                    return true;
+                }
+                if (s == "SUB_BYTE_RANGE") {
+                    obj = StatementKind::SUB_BYTE_RANGE;
+                    return true;
+                }
+                break;
+            }
+            case 15: {
+                if (s == "MATCH_STATEMENT") {
+                    obj = StatementKind::MATCH_STATEMENT;
+                    return true;
+                }
+                if (s == "ENDIAN_VARIABLE") {
+                    obj = StatementKind::ENDIAN_VARIABLE;
+                    return true;
+                }
+                break;
+            }
+            case 16: {
+                if (s == "ENUM_MEMBER_DECL") {
+                    obj = StatementKind::ENUM_MEMBER_DECL;
+                    return true;
+                }
+                break;
+            }
+            case 17: {
+                if (s == "UNION_MEMBER_DECL") {
+                    obj = StatementKind::UNION_MEMBER_DECL;
+                    return true;
+                }
+                break;
+            }
+            case 20: {
+                if (s == "COMPOSITE_FIELD_DECL") {
+                    obj = StatementKind::COMPOSITE_FIELD_DECL;
+                    return true;
+                }
+                if (s == "PROPERTY_MEMBER_DECL") {
+                    obj = StatementKind::PROPERTY_MEMBER_DECL;
+                    return true;
+                }
+                break;
+            }
+            case 21: {
+                if (s == "LOWERED_IO_STATEMENTS") {
+                    obj = StatementKind::LOWERED_IO_STATEMENTS;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(StreamType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 5: {
+                if (s == "INPUT") {
+                    obj = StreamType::INPUT;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "OUTPUT") {
+                    obj = StreamType::OUTPUT;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(SubByteRangeType& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 5: {
+                if (s == "bytes") {
+                    obj = SubByteRangeType::bytes;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "seek_bytes") {
+                    obj = SubByteRangeType::seek_bytes;
+                    return true;
+                }
+                if (s == "expression") {
+                    obj = SubByteRangeType::expression;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(TypeKind& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 3: {
+                if (s == "INT") {
+                    obj = TypeKind::INT;
+                    return true;
+                }
+                if (s == "PTR") {
+                    obj = TypeKind::PTR;
+                    return true;
+                }
+                break;
+            }
+            case 4: {
+                if (s == "UINT") {
+                    obj = TypeKind::UINT;
+                    return true;
+                }
+                if (s == "BOOL") {
+                    obj = TypeKind::BOOL;
+                    return true;
+                }
+                if (s == "VOID") {
+                    obj = TypeKind::VOID;
+                    return true;
+                }
+                if (s == "META") {
+                    obj = TypeKind::META;
+                    return true;
+                }
+                if (s == "ENUM") {
+                    obj = TypeKind::ENUM;
+                    return true;
+                }
+                break;
+            }
+            case 5: {
+                if (s == "USIZE") {
+                    obj = TypeKind::USIZE;
+                    return true;
+                }
+                if (s == "FLOAT") {
+                    obj = TypeKind::FLOAT;
+                    return true;
+                }
+                if (s == "ARRAY") {
+                    obj = TypeKind::ARRAY;
+                    return true;
+                }
+                if (s == "RANGE") {
+                    obj = TypeKind::RANGE;
+                    return true;
+                }
+                break;
+            }
+            case 6: {
+                if (s == "STRUCT") {
+                    obj = TypeKind::STRUCT;
+                    return true;
+                }
+                if (s == "VECTOR") {
+                    obj = TypeKind::VECTOR;
+                    return true;
+                }
+                break;
+            }
+            case 7: {
+                if (s == "VARIANT") {
+                    obj = TypeKind::VARIANT;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "OPTIONAL") {
+                    obj = TypeKind::OPTIONAL;
+                    return true;
+                }
+                if (s == "FUNCTION") {
+                    obj = TypeKind::FUNCTION;
+                    return true;
+                }
+                break;
+            }
+            case 13: {
+                if (s == "ENCODER_INPUT") {
+                    obj = TypeKind::ENCODER_INPUT;
+                    return true;
+                }
+                if (s == "DECODER_INPUT") {
+                    obj = TypeKind::DECODER_INPUT;
+                    return true;
+                }
+                break;
+            }
+            case 14: {
+                if (s == "ENCODER_RETURN") {
+                    obj = TypeKind::ENCODER_RETURN;
+                    return true;
+                }
+                if (s == "DECODER_RETURN") {
+                    obj = TypeKind::DECODER_RETURN;
+                    return true;
+                }
+                break;
+            }
+            case 16: {
+                if (s == "RECURSIVE_STRUCT") {
+                    obj = TypeKind::RECURSIVE_STRUCT;
+                    return true;
+                }
+                break;
+            }
+            case 22: {
+                if (s == "PROPERTY_SETTER_RETURN") {
+                    obj = TypeKind::PROPERTY_SETTER_RETURN;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(UnaryOp& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 7: {
+                if (s == "bit_not") {
+                    obj = UnaryOp::bit_not;
+                    return true;
+                }
+                break;
+            }
+            case 10: {
+                if (s == "minus_sign") {
+                    obj = UnaryOp::minus_sign;
+                    return true;
+                }
+                break;
+            }
+            case 11: {
+                if (s == "logical_not") {
+                    obj = UnaryOp::logical_not;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+    bool from_json_stream(VariableDeclKind& obj, ::ebmgen::JSONStreamReader& r) {
+        std::string_view s;
+        if (!r.read_string(s)) {
+            return false;
+        }
+        switch (s.size()) {
+            case 7: {
+                if (s == "MUTABLE") {
+                    obj = VariableDeclKind::MUTABLE;
+                    return true;
+                }
+                break;
+            }
+            case 8: {
+                if (s == "CONSTANT") {
+                    obj = VariableDeclKind::CONSTANT;
+                    return true;
+                }
+                break;
+            }
+            case 9: {
+                if (s == "IMMUTABLE") {
+                    obj = VariableDeclKind::IMMUTABLE;
+                    return true;
+                }
+                break;
+            }
+        }
+        return false;
+    }
+    
+} // namespace ebm
@@ -0,0 +1,185 @@
+/*license*/
+// Code generated by ebmcodegen at https://github.com/on-keyday/rebrgen
+#pragma once
+#include <ebm/extended_binary_module.hpp>
+#include <ebmgen/json_stream.hpp>
+namespace ebm {
+    bool from_json_stream(AnyRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(AssertDesc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Block& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(CallDesc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(CompositeFieldDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Condition& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(DebugInfo& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(EndianConvertDesc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(EndianVariable& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(EnumDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(EnumMemberDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ErrorReport& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Expression& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ExpressionBody& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ExpressionRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Expressions& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ExtendedBinaryModule& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(FieldDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(FuncTypeDesc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(FunctionDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(IOAttribute& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(IOData& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Identifier& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(IdentifierRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(IfStatement& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ImportDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(InitCheck& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Instruction& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(JumpOffset& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LengthCheck& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Loc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoopFlowControl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoopStatement& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoweredExpressionRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoweredIOStatement& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoweredIOStatements& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoweredStatementRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(MatchBranch& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(MatchStatement& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Metadata& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(OptionalImmediateSize& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ParameterDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(PropertyDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(PropertyMemberDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(RefAlias& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(RegisterIndex& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ReserveData& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(SetEndian& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Size& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Statement& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StatementBody& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StatementRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(String& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StringLiteral& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StringRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StructDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(SubByteRange& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Type& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(TypeBody& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(TypeCastDesc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(TypeRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Types& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(VariableDecl& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(VariantDesc& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Varint& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(WeakStatementRef& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(AliasHint& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ArrayAnnotation& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(BinaryOp& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(CastType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(CompositeFieldKind& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(Endian& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(ExpressionKind& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(FuncTypeAnnotation& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(FunctionKind& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(InitCheckType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LengthCheckType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoopType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(LoweringIOType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(MergeMode& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(OpCode& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(SetterStatus& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(SizeUnit& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StatementKind& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(StreamType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(SubByteRangeType& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(TypeKind& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(UnaryOp& obj, ::ebmgen::JSONStreamReader& r);
+    
+    bool from_json_stream(VariableDeclKind& obj, ::ebmgen::JSONStreamReader& r);
+    
+} // namespace ebm
@@ -9,6 +9,7 @@
 #include "common.hpp"
 #include "ebm/extended_binary_module.hpp"
 #include "json_conv.hpp"
+#include "json_stream_conv.hpp"
 #include <binary/discard.h>
 
 namespace ebmgen {
@@ -126,7 +127,9 @@ namespace ebmgen {
         }
     };
 
-    expected<ebm::ExtendedBinaryModule> decode_json_ebm(futils::view::rvec input) {
+    // path that builds JSON DOM (decode_json_ebm with dom)
+    // accepts object members in any order and reports parse error detail
+    expected<void> decode_json_ebm_dom(futils::view::rvec input, ebm::ExtendedBinaryModule& ebm) {
         futils::json::BytesLikeReader<futils::view::rvec> r{input};
         r.size = r.bytes.size();
         futils::json::JSONConstructor<futils::json::JSON, futils::json::StaticStack<15, futils::json::JSON>, JSONEBMObserver> jc;
@@ -138,13 +141,28 @@ namespace ebmgen {
             return unexpect_error("cannot parse json file: {} {}", futils::json::to_string(result), futils::json::to_string(p.state.state()));
         }
         auto js = std::move(jc.stack.back());
-        ebm::ExtendedBinaryModule ebm;
-        ///*
         if (!futils::json::convert_from_json(js, ebm)) {
             return unexpect_error("cannot convert json file");
         }
-        //*/
-        // return unexpect_error("not implemented yet");
+        return {};
+    }
+
+    expected<ebm::ExtendedBinaryModule> decode_json_ebm(futils::view::rvec input, bool dom) {
+        ebm::ExtendedBinaryModule ebm;
+        if (dom) {
+            MAYBE_VOID(decoded, decode_json_ebm_dom(input, ebm));
+        }
+        else {
+            // decode directly into ebm without DOM
+            // body setters require `kind` to precede other members (as emitted by JSONPrinter)
+            JSONStreamReader stream{std::string_view(reinterpret_cast<const char*>(input.data()), input.size())};
+            if (!ebm::from_json_stream(ebm, stream)) {
+                return unexpect_error("cannot decode json ebm at offset {} (members must be in JSONPrinter order unless --json-dom is given)", stream.offset());
+            }
+            if (!stream.at_end()) {
+                return unexpect_error("unexpected remaining data at offset {} of json ebm", stream.offset());
+            }
+        }
         // check this is encodable
         futils::binary::writer w{&futils::binary::discard<>, nullptr};
         auto err = ebm.encode(w);
@@ -154,12 +172,12 @@ namespace ebmgen {
         return ebm;
     }
 
-    expected<ebm::ExtendedBinaryModule> load_json_ebm(std::string_view input) {
+    expected<ebm::ExtendedBinaryModule> load_json_ebm(std::string_view input, bool dom) {
         futils::file::View view;
         if (auto res = view.open(input); !res) {
             return unexpect_error(Error(res.error()));
         }
-        return decode_json_ebm(futils::view::rvec(view));
+        return decode_json_ebm(futils::view::rvec(view), dom);
     }
 
     expected<void> load_ebm_to_repository(EBMRepository& repo, ebm::ExtendedBinaryModule&& ebm) {
@@ -11,8 +11,10 @@ namespace ebmgen {
     // Function to load brgen AST from JSON
     expected<std::pair<std::shared_ptr<brgen::ast::Node>, std::vector<std::string>>> load_json(std::string_view input, std::function<void(const char*)> timer_cb);
     expected<std::pair<std::shared_ptr<brgen::ast::Node>, std::vector<std::string>>> load_json_file(futils::view::rvec input, std::function<void(const char*)> timer_cb);
-    expected<ebm::ExtendedBinaryModule> load_json_ebm(std::string_view input);
-    expected<ebm::ExtendedBinaryModule> decode_json_ebm(futils::view::rvec input);
+    // members must be in same order as JSONPrinter emits (at least `kind` before kind dependent members)
+    // dom builds JSON DOM and accepts members in any order (slower, for hand written input)
+    expected<ebm::ExtendedBinaryModule> load_json_ebm(std::string_view input, bool dom = false);
+    expected<ebm::ExtendedBinaryModule> decode_json_ebm(futils::view::rvec input, bool dom = false);
 
     // Test-only accessor for EBMRepository internals
     // This class is a friend of EBMRepository and provides access to internal methods
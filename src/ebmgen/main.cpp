@@ -17,6 +17,8 @@
 #include "load_json.hpp"
 #include "convert.hpp"
 #include "debug_printer.hpp"  // Include the new header
+#include "diff.hpp"
+#include "mem_report.hpp"
 #include "stdin.hpp"
 #include "transform/control_flow_graph.hpp"
 #include "unicode/utf/convert.h"
@@ -32,6 +34,7 @@
 #include <tool/src2json/capi.h>  // libs2j C API
 #include <env/env_sys.h>
 #include <wrap/exepath.h>
+#include <helper/defer.h>
 #include <filesystem>
 #include "interactive/debugger.hpp"
 #include <string_view>
@@ -64,6 +67,7 @@ enum class QueryOutputFormat {
     Text,
     JSON,
     Hex,
+    Fingerprint,
 };
 
 struct Flags : futils::cmdline::templ::HelpOption {
@@ -72,6 +76,7 @@ struct Flags : futils::cmdline::templ::HelpOption {
     std::string_view debug_output;  // New flag for debug output
     InputFormat input_format = InputFormat::AUTO;
     DebugOutputFormat debug_format = DebugOutputFormat::Text;
+    size_t debug_threads = 1;
     QueryOutputFormat query_output_format = QueryOutputFormat::ID;
     std::string_view cfg_output;
     OutputFormat output_format = OutputFormat::Binary;
@@ -82,9 +87,15 @@ struct Flags : futils::cmdline::templ::HelpOption {
     bool interactive = false;
     bool show_flags = false;
     std::string_view query;
+    size_t query_threads = 0;
+    std::string_view diff_target;
     bool timing = false;
     bool print_output_size = false;
+    bool mem_report = false;
     bool verify_uniqueness = false;
+    bool no_licm = false;
+    bool no_cse = false;
+    bool json_dom = false;
 
     void bind(futils::cmdline::option::Context& ctx) {
         auto exe_path = futils::wrap::get_exepath();
@@ -108,12 +119,14 @@ struct Flags : futils::cmdline::templ::HelpOption {
                        {"text", DebugOutputFormat::Text},
                        {"json", DebugOutputFormat::JSON},
                    });
-        ctx.VarMap(&query_output_format, "query-format", "query output format (default: id)", "{id,text,json}",
+        ctx.VarInt(&debug_threads, "debug-threads", "number of threads to render text debug output (default: 1, 0 means hardware concurrency)", "N");
+        ctx.VarMap(&query_output_format, "query-format", "query output format (default: id)", "{id,text,json,hex,fingerprint}",
                    std::map<std::string, QueryOutputFormat>{
                        {"id", QueryOutputFormat::ID},
                        {"text", QueryOutputFormat::Text},
                        {"json", QueryOutputFormat::JSON},
                        {"hex", QueryOutputFormat::Hex},
+                       {"fingerprint", QueryOutputFormat::Fingerprint},
 
                    });
         ctx.VarString<true>(&cfg_output, "cfg-output,c", "control flow graph output file (if -, write to stdout)", "FILE");
@@ -135,9 +148,15 @@ struct Flags : futils::cmdline::templ::HelpOption {
         ctx.VarBool(&interactive, "interactive,I", "start interactive debugger");
         ctx.VarBool(&show_flags, "show-flags", "output command line flag description in JSON format");
         ctx.VarString<true>(&query, "query,q", "run query to object and output matched objects to stdout", "QUERY");
+        ctx.VarInt(&query_threads, "query-threads", "number of threads to evaluate query (default: 0, hardware concurrency)", "N");
+        ctx.VarString<true>(&diff_target, "diff", "compare input (as old) with FILE (.ebm or .ebm.json, as new) structurally and print added/removed/changed objects (exit status 1 if any)", "FILE");
         ctx.VarBool(&timing, "timing", "Processing timing (for performance debug)");
         ctx.VarBool(&print_output_size, "output-size", "print output size to stderr (for debugging)");
+        ctx.VarBool(&mem_report, "mem-report", "print memory usage report to stderr at exit (for debugging)");
         ctx.VarBool(&verify_uniqueness, "verify-uniqueness", "verify uniqueness of identifiers during conversion (for debugging)");
+        ctx.VarBool(&no_licm, "no-licm", "disable loop invariant code motion");
+        ctx.VarBool(&no_cse, "no-cse", "disable common subexpression elimination");
+        ctx.VarBool(&json_dom, "json-dom", "decode json-ebm input through JSON DOM, which accepts object members in any order (slower)");
     }
 };
 
@@ -229,10 +248,10 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
     else if (flags.input_format == InputFormat::JSON_EBM) {
         ebmgen::expected<ebm::ExtendedBinaryModule> ret;
         if (stdin_data.stdin_data) {
-            ret = ebmgen::decode_json_ebm(*stdin_data.stdin_data);
+            ret = ebmgen::decode_json_ebm(*stdin_data.stdin_data, flags.json_dom);
         }
         else {
-            ret = ebmgen::load_json_ebm(flags.input);
+            ret = ebmgen::load_json_ebm(flags.input, flags.json_dom);
         }
         if (!ret) {
             cerr << "Load Error: " << ret.error().error<std::string>() << '\n';
@@ -303,7 +322,7 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
         }
         TIMING("load and parse");
 
-        auto output = ebmgen::convert_ast_to_ebm(ast->first, std::move(ast->second), ebm, {.not_remove_unused = flags.debug, .verify_uniqueness = flags.verify_uniqueness, .timer_cb = [&](const char* phase) {
+        auto output = ebmgen::convert_ast_to_ebm(ast->first, std::move(ast->second), ebm, {.not_remove_unused = flags.debug, .verify_uniqueness = flags.verify_uniqueness, .no_licm = flags.no_licm, .no_cse = flags.no_cse, .timer_cb = [&](const char* phase) {
                                                                                                TIMING(phase);
                                                                                            }});
         if (!output) {
@@ -314,7 +333,7 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
     }
 
     std::optional<ebmgen::MappingTable> table;
-    if (!flags.debug_output.empty() || !flags.cfg_output.empty() || flags.interactive || !flags.query.empty()) {
+    if (!flags.debug_output.empty() || !flags.cfg_output.empty() || flags.interactive || !flags.query.empty() || !flags.diff_target.empty()) {
         table.emplace(ebm);
     }
     if (flags.input_format == InputFormat::EBM || flags.input_format == InputFormat::JSON_EBM) {
@@ -327,46 +346,102 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
         }
     }
 
+    // report at any exit point below, while ebm and table are still alive
+    const auto _mem_report = futils::helper::defer([&] {
+        if (!flags.mem_report) {
+            return;
+        }
+        ebmgen::MemoryReport report;
+        ebmgen::collect_module_memory(report, ebm);
+        if (table) {
+            report.mapping = table->memory_usage();
+        }
+        report.peak_rss = ebmgen::peak_rss_bytes();
+        std::stringstream ss;
+        ebmgen::print_memory_report(ss, report);
+        cerr << ss.str();
+    });
+
+    if (!flags.diff_target.empty()) {
+        ebm::ExtendedBinaryModule new_ebm;
+        if (flags.diff_target.ends_with(".ebm.json")) {
+            auto ret = ebmgen::load_json_ebm(flags.diff_target, flags.json_dom);
+            if (!ret) {
+                cerr << "Load Error: " << ret.error().error<std::string>() << '\n';
+                return 1;
+            }
+            new_ebm = std::move(*ret);
+        }
+        else {
+            futils::file::View view;
+            if (auto res = view.open(flags.diff_target); !res) {
+                cerr << "error: failed to open " << flags.diff_target << ": " << res.error().template error<std::string>() << '\n';
+                return 1;
+            }
+            futils::binary::reader r{futils::view::rvec(view)};
+            if (auto err = new_ebm.decode(r)) {
+                cerr << "error: failed to load ebm: " << err.template error<std::string>() << '\n';
+                return 1;
+            }
+        }
+        ebmgen::MappingTable new_table(new_ebm);
+        if (!new_table.valid()) {
+            cerr << "error: invalid ebm structure; " << flags.diff_target << '\n';
+            return 1;
+        }
+        TIMING("diff load");
+        auto diff = ebmgen::diff_module(*table, new_table);
+        std::stringstream diff_ss;
+        ebmgen::print_diff(diff_ss, diff, *table, new_table);
+        cout << diff_ss.str();
+        TIMING("diff");
+        // like diff(1), nonzero if modules differ
+        return diff.empty() ? 0 : 1;
+    }
+
     // Debug print if requested
     if (!flags.debug_output.empty()) {
-        auto save_to_file = [&](auto&& out) {
-            if (flags.debug_output == "-") {
-                cout << out;
+        // stream to file writer so that whole text dump is not held in memory
+        auto write_debug = [&](futils::binary::writer& w) {
+            if (flags.debug_format == DebugOutputFormat::Text) {
+                ebmgen::WriterStreamBuf buf{w};
+                std::ostream debug_os(&buf);
+                ebmgen::DebugPrinter printer(*table, debug_os);
+                printer.set_threads(flags.debug_threads);
+                printer.print_module();
+                debug_os.flush();
+            }
+            else if (flags.debug_format == DebugOutputFormat::JSON) {
+                ebmgen::JSONPrinter p(*table);
+                p.set_sink(&w);
+                futils::json::Stringer<> s;
+                p.print_module(s);
             }
             else {
-                std::ofstream debug_ofs(std::string(flags.debug_output));
-                if (!debug_ofs.is_open()) {
-                    cerr << "Failed to open debug output file: " << flags.debug_output << '\n';
-                    return 1;
-                }
-                debug_ofs << out;
-                debug_ofs.close();
+                cerr << "Unsupported format\n";
+                return 1;
             }
             return 0;
         };
-        if (flags.debug_format == DebugOutputFormat::Text) {
-            std::stringstream debug_ss;
-            ebmgen::DebugPrinter printer(*table, debug_ss);
-
-            printer.print_module();
-            auto ret = save_to_file(debug_ss.str());
-            if (ret != 0) {
+        if (flags.debug_output == "-") {
+            futils::file::FileStream<std::string> fs{futils::file::File::stdout_file()};
+            futils::binary::writer writer{fs.get_write_handler(), &fs};
+            if (auto ret = write_debug(writer); ret != 0) {
                 return ret;
             }
         }
-        else if (flags.debug_format == DebugOutputFormat::JSON) {
-            ebmgen::JSONPrinter p(*table);
-            futils::json::Stringer<> s;
-            p.print_module(s);
-            auto ret = save_to_file(s.out());
-            if (ret != 0) {
+        else {
+            auto file = futils::file::File::create(flags.debug_output);
+            if (!file) {
+                cerr << "Failed to open debug output file: " << flags.debug_output << ": " << file.error().error<std::string>() << '\n';
+                return 1;
+            }
+            futils::file::FileStream<std::string> fs{*file};
+            futils::binary::writer writer{fs.get_write_handler(), &fs};
+            if (auto ret = write_debug(writer); ret != 0) {
                 return ret;
             }
         }
-        else {
-            cerr << "Unsupported format\n";
-            return 1;
-        }
         TIMING("debug output");
     }
 
@@ -485,7 +560,7 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
     }
 
     if (flags.query.size() > 0) {
-        auto r = ebmgen::run_query(*table, flags.query);
+        auto r = ebmgen::run_query(*table, flags.query, flags.query_threads);
         if (!r) {
             cerr << "Query Error: " << r.error().error<std::string>() << '\n';
             return 1;
@@ -525,6 +600,12 @@ int Main(Flags& flags, futils::cmdline::option::Context& ctx) {
             cout << ss.str();
             cout << "Total matched objects: " << result.size() << "\n";
         }
+        else if (flags.query_output_format == QueryOutputFormat::Fingerprint) {
+            for (auto obj : result) {
+                cout << get_id(obj) << ' ' << std::format("{:016x}", table->fingerprint(obj)) << '\n';
+            }
+            cout << "module " << std::format("{:016x}", table->module_fingerprint()) << '\n';
+        }
         else if (flags.query_output_format == QueryOutputFormat::Hex) {
             for (auto obj : result) {
                 auto objv = table->get_object(obj);
@@ -7,11 +7,16 @@ namespace ebmgen {
     bool verbose_error;
     // Builds maps from vector data for faster access
     void MappingTable::build_maps(mapping::BuildMapOption options) {
+        query_indexes_.reset();
+        fingerprints_.reset();
         if (options & mapping::BuildMapOption::BUILD_MAP_SKIP_IF_UNCHANGED) {
             if (original_id_count() == mapped_id_count()) {
                 return;
             }
         }
+        if (maps_.use_count() > 1) {
+            maps_ = std::make_shared<Maps>(*maps_);
+        }
 
         auto map_to = [&](auto& map, const auto& vec, ebm::AliasHint hint) {
             for (const auto& item : vec) {
@@ -22,7 +27,7 @@ namespace ebmgen {
                 item.body.visit([&](auto&& visitor, const char* name, auto&& val, std::optional<size_t> index = std::nullopt) -> void {
                     if constexpr (AnyRef<decltype(val)>) {
                         if (!is_nil(val)) {
-                            inverse_refs_[get_id(val)].push_back(InverseRef{
+                            maps_->inverse_refs_[get_id(val)].push_back(InverseRef{
                                 .name = name,
                                 .index = index,
                                 .ref = to_any_ref(item.id),
@@ -40,15 +45,15 @@ namespace ebmgen {
                 });
             }
         };
-        map_to(identifier_map_, module_.identifiers, ebm::AliasHint::IDENTIFIER);
-        map_to(string_literal_map_, module_.strings, ebm::AliasHint::STRING);
-        map_to(type_map_, module_.types, ebm::AliasHint::TYPE);
-        map_to(statement_map_, module_.statements, ebm::AliasHint::STATEMENT);
-        map_to(expression_map_, module_.expressions, ebm::AliasHint::EXPRESSION);
+        map_to(maps_->identifier_map_, module_.identifiers, ebm::AliasHint::IDENTIFIER);
+        map_to(maps_->string_literal_map_, module_.strings, ebm::AliasHint::STRING);
+        map_to(maps_->type_map_, module_.types, ebm::AliasHint::TYPE);
+        map_to(maps_->statement_map_, module_.statements, ebm::AliasHint::STATEMENT);
+        map_to(maps_->expression_map_, module_.expressions, ebm::AliasHint::EXPRESSION);
 
         auto map_alias = [&](auto& map, const auto& alias) {
             map[get_id(alias.from)] = map[get_id(alias.to)];
-            inverse_refs_[get_id(alias.to)].push_back(InverseRef{
+            maps_->inverse_refs_[get_id(alias.to)].push_back(InverseRef{
                 .name = to_string(alias.hint),
                 .ref = to_any_ref(alias.from),
                 .hint = ebm::AliasHint::ALIAS,
@@ -58,19 +63,19 @@ namespace ebmgen {
         for (const auto& alias : module_.aliases) {
             switch (alias.hint) {
                 case ebm::AliasHint::IDENTIFIER:
-                    map_alias(identifier_map_, alias);
+                    map_alias(maps_->identifier_map_, alias);
                     break;
                 case ebm::AliasHint::STRING:
-                    map_alias(string_literal_map_, alias);
+                    map_alias(maps_->string_literal_map_, alias);
                     break;
                 case ebm::AliasHint::TYPE:
-                    map_alias(type_map_, alias);
+                    map_alias(maps_->type_map_, alias);
                     break;
                 case ebm::AliasHint::EXPRESSION:
-                    map_alias(expression_map_, alias);
+                    map_alias(maps_->expression_map_, alias);
                     break;
                 case ebm::AliasHint::STATEMENT:
-                    map_alias(statement_map_, alias);
+                    map_alias(maps_->statement_map_, alias);
                     break;
                 case ebm::AliasHint::ALIAS:
                     // ALIAS hint is not used for mapping, it's just a marker
@@ -79,30 +84,47 @@ namespace ebmgen {
         }
         if (options & mapping::BuildMapOption::BUILD_MAP_USE_DEBUG_LOC) {
             for (const auto& debug_loc : module_.locs) {
-                debug_loc_map_[get_id(debug_loc.ident)] = &debug_loc;
+                maps_->debug_loc_map_[get_id(debug_loc.ident)] = &debug_loc;
             }
         }
     }
 
+    bool MappingTable::share_maps(const MappingTable& other) {
+        if (&other.module_.statements != &module_.statements ||
+            &other.module_.expressions != &module_.expressions ||
+            &other.module_.types != &module_.types ||
+            &other.module_.identifiers != &module_.identifiers ||
+            &other.module_.strings != &module_.strings ||
+            &other.module_.aliases != &module_.aliases ||
+            &other.module_.locs != &module_.locs ||
+            !other.valid()) {
+            return false;
+        }
+        maps_ = other.maps_;
+        query_indexes_.reset();
+        fingerprints_.reset();
+        return true;
+    }
+
     // --- Helper functions to get objects from references ---
     const ebm::Identifier* MappingTable::get_identifier(const ebm::IdentifierRef& ref) const {
-        auto it = identifier_map_.find(get_id(ref));
-        return (it != identifier_map_.end()) ? it->second : nullptr;
+        auto it = maps_->identifier_map_.find(get_id(ref));
+        return (it != maps_->identifier_map_.end()) ? it->second : nullptr;
     }
 
     const ebm::StringLiteral* MappingTable::get_string_literal(const ebm::StringRef& ref) const {
-        auto it = string_literal_map_.find(get_id(ref));
-        return (it != string_literal_map_.end()) ? it->second : nullptr;
+        auto it = maps_->string_literal_map_.find(get_id(ref));
+        return (it != maps_->string_literal_map_.end()) ? it->second : nullptr;
     }
 
     const ebm::Type* MappingTable::get_type(const ebm::TypeRef& ref) const {
-        auto it = type_map_.find(get_id(ref));
-        return (it != type_map_.end()) ? it->second : nullptr;
+        auto it = maps_->type_map_.find(get_id(ref));
+        return (it != maps_->type_map_.end()) ? it->second : nullptr;
     }
 
     const ebm::Statement* MappingTable::get_statement(const ebm::StatementRef& ref) const {
-        auto it = statement_map_.find(get_id(ref));
-        return (it != statement_map_.end()) ? it->second : nullptr;
+        auto it = maps_->statement_map_.find(get_id(ref));
+        return (it != maps_->statement_map_.end()) ? it->second : nullptr;
     }
 
     const ebm::Statement* MappingTable::get_statement(const ebm::WeakStatementRef& ref) const {
@@ -110,8 +132,8 @@ namespace ebmgen {
     }
 
     const ebm::Expression* MappingTable::get_expression(const ebm::ExpressionRef& ref) const {
-        auto it = expression_map_.find(get_id(ref));
-        return (it != expression_map_.end()) ? it->second : nullptr;
+        auto it = maps_->expression_map_.find(get_id(ref));
+        return (it != maps_->expression_map_.end()) ? it->second : nullptr;
     }
 
     ObjectVariant MappingTable::get_object(const ebm::AnyRef& ref) const {
@@ -166,8 +188,8 @@ namespace ebmgen {
     }
 
     const std::vector<InverseRef>* MappingTable::get_inverse_ref(const ebm::AnyRef& ref) const {
-        auto it = inverse_refs_.find(get_id(ref));
-        if (it != inverse_refs_.end()) {
+        auto it = maps_->inverse_refs_.find(get_id(ref));
+        if (it != maps_->inverse_refs_.end()) {
             return &it->second;
         }
         return nullptr;
@@ -301,11 +323,11 @@ namespace ebmgen {
     }
 
     size_t MappingTable::mapped_id_count() const {
-        return identifier_map_.size() +
-               string_literal_map_.size() +
-               type_map_.size() +
-               statement_map_.size() +
-               expression_map_.size();
+        return maps_->identifier_map_.size() +
+               maps_->string_literal_map_.size() +
+               maps_->type_map_.size() +
+               maps_->statement_map_.size() +
+               maps_->expression_map_.size();
     }
 
     bool MappingTable::valid() const {
@@ -313,13 +335,94 @@ namespace ebmgen {
     }
 
     const ebm::Loc* MappingTable::get_debug_loc(const ebm::AnyRef& ref) const {
-        auto it = debug_loc_map_.find(get_id(ref));
-        if (it != debug_loc_map_.end()) {
+        auto it = maps_->debug_loc_map_.find(get_id(ref));
+        if (it != maps_->debug_loc_map_.end()) {
             return it->second;
         }
         return nullptr;
     }
 
+    const MappingTable::QueryIndexes& MappingTable::query_indexes() const {
+        if (query_indexes_) {
+            return *query_indexes_;
+        }
+        auto& indexes = query_indexes_.emplace();
+        // name is same as what query compares with `id == "name"`
+        auto index_name = [&](QueryIndex& index, const auto& vec) {
+            for (const auto& item : vec) {
+                auto ref = to_any_ref(item.id);
+                if (auto ident = get_identifier(ref)) {
+                    index[ident->body.data].push_back(ref);
+                }
+                else if (auto str = get_string_literal(ebm::StringRef{ref.id})) {
+                    index[str->body.data].push_back(ref);
+                }
+            }
+        };
+        auto index_kind = [&](QueryIndex& index, const auto& vec) {
+            for (const auto& item : vec) {
+                index[to_string(item.body.kind, true)].push_back(to_any_ref(item.id));
+            }
+        };
+        index_name(indexes.identifier_name, module_.identifiers);
+        index_name(indexes.string_name, module_.strings);
+        index_name(indexes.type_name, module_.types);
+        index_name(indexes.statement_name, module_.statements);
+        index_name(indexes.expression_name, module_.expressions);
+        index_kind(indexes.type_kind, module_.types);
+        index_kind(indexes.statement_kind, module_.statements);
+        index_kind(indexes.expression_kind, module_.expressions);
+        return indexes;
+    }
+
+    const std::vector<ebm::AnyRef>* MappingTable::find_by_kind(ebm::AliasHint table, std::string_view kind) const {
+        auto& indexes = query_indexes();
+        const QueryIndex* index = nullptr;
+        switch (table) {
+            case ebm::AliasHint::TYPE:
+                index = &indexes.type_kind;
+                break;
+            case ebm::AliasHint::STATEMENT:
+                index = &indexes.statement_kind;
+                break;
+            case ebm::AliasHint::EXPRESSION:
+                index = &indexes.expression_kind;
+                break;
+            default:
+                return nullptr;  // no kind field
+        }
+        static const std::vector<ebm::AnyRef> empty;
+        auto it = index->find(kind);
+        return it != index->end() ? &it->second : &empty;
+    }
+
+    const std::vector<ebm::AnyRef>* MappingTable::find_by_identifier_name(ebm::AliasHint table, std::string_view name) const {
+        auto& indexes = query_indexes();
+        const QueryIndex* index = nullptr;
+        switch (table) {
+            case ebm::AliasHint::IDENTIFIER:
+                index = &indexes.identifier_name;
+                break;
+            case ebm::AliasHint::STRING:
+                index = &indexes.string_name;
+                break;
+            case ebm::AliasHint::TYPE:
+                index = &indexes.type_name;
+                break;
+            case ebm::AliasHint::STATEMENT:
+                index = &indexes.statement_name;
+                break;
+            case ebm::AliasHint::EXPRESSION:
+                index = &indexes.expression_name;
+                break;
+            default:
+                return nullptr;
+        }
+        static const std::vector<ebm::AnyRef> empty;
+        auto it = index->find(name);
+        return it != index->end() ? &it->second : &empty;
+    }
+
     void MappingTable::directly_map_statement_identifier(ebm::StatementRef ref, std::string&& name) {
         statement_identifier_direct_map_[get_id(ref)] = std::move(name);
     }
@@ -2,6 +2,9 @@
 #pragma once
 #include <ebm/extended_binary_module.hpp>
 #include <unordered_map>
+#include <map>
+#include <memory>
+#include <optional>
 #include <cstdint>
 #include <variant>
 #include <vector>
@@ -46,6 +49,11 @@ namespace ebmgen {
 
     struct lazy_init_tag {};
 
+    struct MappingMemoryUsage {
+        size_t entries = 0;
+        size_t bytes = 0;  // estimated from node and bucket sizes
+    };
+
     constexpr lazy_init_tag lazy_init{};
 
     namespace mapping {
@@ -66,12 +74,12 @@ namespace ebmgen {
 
     struct MappingTable {
         explicit MappingTable(EBMProxy module)
-            : module_(module) {
+            : module_(module), maps_(std::make_shared<Maps>()) {
             build_maps();
         }
 
         explicit MappingTable(EBMProxy module, lazy_init_tag)
-            : module_(module) {
+            : module_(module), maps_(std::make_shared<Maps>()) {
         }
 
         bool valid() const;
@@ -158,23 +166,88 @@ namespace ebmgen {
         void directly_map_statement_identifier(ebm::StatementRef ref, std::string&& name);
         void remove_directly_mapped_statement_identifier(ebm::StatementRef ref);
         void build_maps(mapping::BuildMapOption options = mapping::BuildMapOption::BUILD_MAP_USE_DEBUG_LOC | mapping::BuildMapOption::BUILD_MAP_USE_INVERSE_REF);
+        // use lookup maps of other instead of building them (e.g. one table shared by generators of ebmcodegen-multi)
+        // other must be built on same module and is not modified; later build_maps copies maps before updating them
+        // identifier modifier, direct mapping, default prefixes and query/fingerprint caches are not shared
+        // returns false (and does nothing) if other is built on another module or not valid
+        bool share_maps(const MappingTable& other);
+
+        // lazily built indexes for query planner
+        // results are ordered same as module tables
+        // table must be one of IDENTIFIER, STRING, TYPE, STATEMENT or EXPRESSION
+        const std::vector<ebm::AnyRef>* find_by_kind(ebm::AliasHint table, std::string_view kind) const;
+        // objects whose associated identifier (or string literal) is name
+        const std::vector<ebm::AnyRef>* find_by_identifier_name(ebm::AliasHint table, std::string_view name) const;
+        // build indexes above in advance, because lazy build is not thread safe
+        void prepare_query_index() const {
+            query_indexes();
+        }
+
+        // Merkle style content hash of object
+        // covers body and referenced objects (recursively) but not concrete id values,
+        // so that it is stable across renumbering. back references (WeakStatementRef) and
+        // reference cycles contribute only kind and identifier name of the target
+        // returns 0 for nil or unknown reference
+        std::uint64_t fingerprint(const ebm::AnyRef& ref) const;
+        template <AnyRef T>
+        std::uint64_t fingerprint(const T& ref) const {
+            return fingerprint(to_any_ref(ref));
+        }
+        // independent of table order and id values
+        std::uint64_t module_fingerprint() const;
+        // compute fingerprints above in advance, because lazy computation is not thread safe
+        void prepare_fingerprints() const {
+            fingerprints();
+        }
+
+        // maps and lazily built caches above (for --mem-report)
+        MappingMemoryUsage memory_usage() const;
 
         void set_identifier_modifier(std::function<void(ebm::StatementRef, std::string&)>&& modifier) {
             identifier_modifier = std::move(modifier);
         }
 
+        const std::function<void(ebm::StatementRef, std::string&)>& get_identifier_modifier() const {
+            return identifier_modifier;
+        }
+
        private:
         EBMProxy module_;
         // Caches for faster lookups
-        std::unordered_map<std::uint64_t, const ebm::Identifier*> identifier_map_;
-        std::unordered_map<std::uint64_t, const ebm::StringLiteral*> string_literal_map_;
-        std::unordered_map<std::uint64_t, const ebm::Type*> type_map_;
-        std::unordered_map<std::uint64_t, const ebm::Statement*> statement_map_;
-        std::unordered_map<std::uint64_t, const ebm::Expression*> expression_map_;
-        std::unordered_map<std::uint64_t, std::vector<InverseRef>> inverse_refs_;
+        // shared by share_maps and copied on write by build_maps
+        struct Maps {
+            std::unordered_map<std::uint64_t, const ebm::Identifier*> identifier_map_;
+            std::unordered_map<std::uint64_t, const ebm::StringLiteral*> string_literal_map_;
+            std::unordered_map<std::uint64_t, const ebm::Type*> type_map_;
+            std::unordered_map<std::uint64_t, const ebm::Statement*> statement_map_;
+            std::unordered_map<std::uint64_t, const ebm::Expression*> expression_map_;
+            std::unordered_map<std::uint64_t, std::vector<InverseRef>> inverse_refs_;
+            std::unordered_map<std::uint64_t, const ebm::Loc*> debug_loc_map_;
+        };
+        std::shared_ptr<Maps> maps_;
         std::unordered_map<ebm::StatementKind, std::string> default_identifier_prefix_;
         std::unordered_map<std::uint64_t, std::string> statement_identifier_direct_map_;
-        std::unordered_map<std::uint64_t, const ebm::Loc*> debug_loc_map_;
         std::function<void(ebm::StatementRef, std::string&)> identifier_modifier;
+
+        using QueryIndex = std::map<std::string, std::vector<ebm::AnyRef>, std::less<>>;
+        struct QueryIndexes {
+            QueryIndex type_kind;
+            QueryIndex statement_kind;
+            QueryIndex expression_kind;
+            QueryIndex identifier_name;
+            QueryIndex string_name;
+            QueryIndex type_name;
+            QueryIndex statement_name;
+            QueryIndex expression_name;
+        };
+        mutable std::optional<QueryIndexes> query_indexes_;
+        const QueryIndexes& query_indexes() const;
+
+        struct Fingerprints {
+            std::unordered_map<std::uint64_t, std::uint64_t> objects;
+            std::uint64_t module = 0;
+        };
+        mutable std::optional<Fingerprints> fingerprints_;
+        const Fingerprints& fingerprints() const;
     };
 }  // namespace ebmgen
\ No newline at end of file
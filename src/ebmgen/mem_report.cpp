@@ -0,0 +1,173 @@
+/*license*/
+#include "mem_report.hpp"
+#include <format>
+#include <string>
+#include <type_traits>
+#include "helper/template_instance.h"
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace ebmgen {
+
+    // heap bytes held by value (not including sizeof(value) itself)
+    struct HeapSizeWalker {
+        template <typename T>
+        static size_t of(const T& v) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                // short strings are stored inline
+                return v.capacity() > std::string().capacity() ? v.capacity() + 1 : 0;
+            }
+            else if constexpr (futils::helper::is_template_instance_of<T, std::vector>) {
+                size_t size = v.capacity() * sizeof(typename T::value_type);
+                for (const auto& elem : v) {
+                    size += of(elem);
+                }
+                return size;
+            }
+            else if constexpr (has_visit<T, DummyFn>) {
+                size_t size = 0;
+                v.visit([&](auto&&, const char*, auto&& field) {
+                    size += field_of(field);
+                });
+                return size;
+            }
+            else {
+                return 0;  // enums, integers, references
+            }
+        }
+
+        template <typename T>
+        static size_t field_of(const T& v) {
+            return of(v);
+        }
+
+        template <typename T>
+        static size_t field_of(const T* v) {
+            if constexpr (std::is_same_v<T, char>) {
+                return 0;  // literal
+            }
+            else {
+                return v ? of(*v) : 0;
+            }
+        }
+    };
+
+    void collect_module_memory(MemoryReport& report, const ebm::ExtendedBinaryModule& ebm) {
+        auto add = [&](const char* name, const auto& objects) {
+            using T = typename std::decay_t<decltype(objects)>::value_type;
+            TableMemoryUsage usage{.name = name, .count = objects.size(), .object_bytes = objects.capacity() * sizeof(T)};
+            for (const auto& obj : objects) {
+                usage.body_bytes += HeapSizeWalker::of(obj);
+            }
+            report.tables.push_back(usage);
+        };
+        add("identifiers", ebm.identifiers);
+        add("strings", ebm.strings);
+        add("types", ebm.types);
+        add("statements", ebm.statements);
+        add("expressions", ebm.expressions);
+        add("aliases", ebm.aliases);
+        add("debug_info.files", ebm.debug_info.files);
+        add("debug_info.locs", ebm.debug_info.locs);
+    }
+
+    template <typename Map>
+    void add_map_usage(MappingMemoryUsage& usage, const Map& map) {
+        usage.entries += map.size();
+        if constexpr (requires { map.bucket_count(); }) {
+            // node holds value, next pointer and cached hash
+            usage.bytes += map.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*)) + map.bucket_count() * sizeof(void*);
+        }
+        else {
+            // red-black tree node holds value, three pointers and color
+            usage.bytes += map.size() * (sizeof(typename Map::value_type) + 4 * sizeof(void*));
+        }
+    }
+
+    MappingMemoryUsage MappingTable::memory_usage() const {
+        MappingMemoryUsage usage;
+        add_map_usage(usage, maps_->identifier_map_);
+        add_map_usage(usage, maps_->string_literal_map_);
+        add_map_usage(usage, maps_->type_map_);
+        add_map_usage(usage, maps_->statement_map_);
+        add_map_usage(usage, maps_->expression_map_);
+        add_map_usage(usage, maps_->inverse_refs_);
+        for (auto& [_, refs] : maps_->inverse_refs_) {
+            usage.bytes += refs.capacity() * sizeof(InverseRef);
+        }
+        add_map_usage(usage, default_identifier_prefix_);
+        add_map_usage(usage, statement_identifier_direct_map_);
+        for (auto& [_, name] : statement_identifier_direct_map_) {
+            usage.bytes += HeapSizeWalker::of(name);
+        }
+        add_map_usage(usage, maps_->debug_loc_map_);
+        if (query_indexes_) {
+            for (auto index : {&query_indexes_->type_kind, &query_indexes_->statement_kind, &query_indexes_->expression_kind,
+                               &query_indexes_->identifier_name, &query_indexes_->string_name, &query_indexes_->type_name,
+                               &query_indexes_->statement_name, &query_indexes_->expression_name}) {
+                add_map_usage(usage, *index);
+                for (auto& [key, refs] : *index) {
+                    usage.bytes += HeapSizeWalker::of(key) + refs.capacity() * sizeof(ebm::AnyRef);
+                }
+            }
+        }
+        if (fingerprints_) {
+            add_map_usage(usage, fingerprints_->objects);
+        }
+        return usage;
+    }
+
+    std::optional<size_t> peak_rss_bytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return std::nullopt;
+        }
+        return counters.PeakWorkingSetSize;
+#elif defined(__unix__) || defined(__APPLE__)
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return std::nullopt;
+        }
+#if defined(__APPLE__)
+        return size_t(usage.ru_maxrss);  // bytes
+#else
+        return size_t(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+#else
+        return std::nullopt;
+#endif
+    }
+
+    void print_memory_report(std::ostream& os, const MemoryReport& report) {
+        auto kib = [](size_t bytes) {
+            return std::format("{:.1f} KiB", double(bytes) / 1024);
+        };
+        os << "Memory report:\n";
+        size_t total = 0;
+        for (auto& table : report.tables) {
+            os << std::format("  {:<18} {:>10} objects, {:>14} table, {:>14} bodies\n", table.name, table.count, kib(table.object_bytes), kib(table.body_bytes));
+            total += table.object_bytes + table.body_bytes;
+        }
+        if (!report.tables.empty()) {
+            os << std::format("  {:<18} {:>14}\n", "module total", kib(total));
+        }
+        if (report.mapping) {
+            os << std::format("  {:<18} {:>10} entries, {:>14} (estimated)\n", "mapping table", report.mapping->entries, kib(report.mapping->bytes));
+        }
+        if (report.writer) {
+            os << std::format("  {:<18} {:>14} output, {:>14} temporary total, {:>14} temporary peak, depth {}\n", "code writer",
+                              kib(report.writer->output_bytes), kib(report.writer->tmp_total_bytes), kib(report.writer->tmp_peak_bytes), report.writer->tmp_max_depth);
+        }
+        if (report.peak_rss) {
+            os << std::format("  {:<18} {:>14}\n", "peak rss", kib(*report.peak_rss));
+        }
+        else {
+            os << std::format("  {:<18} {:>14}\n", "peak rss", "unavailable");
+        }
+    }
+}  // namespace ebmgen
@@ -0,0 +1,38 @@
+/*license*/
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <vector>
+#include "mapping.hpp"
+
+namespace ebmgen {
+    struct TableMemoryUsage {
+        const char* name = "";
+        size_t count = 0;
+        size_t object_bytes = 0;  // table storage (capacity * element size)
+        size_t body_bytes = 0;    // heap held by bodies (Block containers, String data, etc.)
+    };
+
+    struct WriterMemoryUsage {
+        size_t output_bytes = 0;     // bytes written to root writer
+        size_t tmp_total_bytes = 0;  // sum of bytes rendered into temporary writers
+        size_t tmp_peak_bytes = 0;   // largest temporary writer
+        size_t tmp_max_depth = 0;    // max number of temporary writers alive at once
+    };
+
+    struct MemoryReport {
+        std::vector<TableMemoryUsage> tables;
+        std::optional<MappingMemoryUsage> mapping;
+        std::optional<WriterMemoryUsage> writer;
+        std::optional<size_t> peak_rss;  // nullopt if not supported on this platform
+    };
+
+    // walk each table with visit() and count heap bytes held by objects
+    void collect_module_memory(MemoryReport& report, const ebm::ExtendedBinaryModule& ebm);
+
+    // peak resident set size of current process in bytes
+    std::optional<size_t> peak_rss_bytes();
+
+    void print_memory_report(std::ostream& os, const MemoryReport& report);
+}  // namespace ebmgen
@@ -0,0 +1,39 @@
+/*license*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ebmgen {
+    // run task(index, worker) for each index in [0, count) on `workers` threads
+    // worker is in [0, workers) and same worker never runs concurrently
+    inline void run_parallel(size_t count, size_t workers, auto&& task) {
+        std::atomic_size_t next = 0;
+        auto work = [&](size_t worker) {
+            while (true) {
+                auto i = next.fetch_add(1);
+                if (i >= count) {
+                    break;
+                }
+                task(i, worker);
+            }
+        };
+        std::vector<std::thread> pool;
+        for (size_t w = 1; w < workers; w++) {
+            pool.emplace_back(work, w);
+        }
+        work(0);
+        for (auto& t : pool) {
+            t.join();
+        }
+    }
+
+    // 0 means hardware concurrency
+    inline size_t resolve_thread_count(size_t threads) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        return threads == 0 ? 1 : threads;
+    }
+}  // namespace ebmgen
@@ -0,0 +1,232 @@
+/*license*/
+#include <gtest/gtest.h>
+#include <binary/writer.h>
+#include <set>
+#include "../load_json.hpp"
+#include "../transform/transform.hpp"
+
+namespace ebmgen {
+    namespace {
+        std::string fixture(std::string_view name) {
+            return std::string(EBMGEN_TRANSFORM_TEST_DIR) + "/" + std::string(name);
+        }
+
+        ebm::Statement* get_statement(TestContextLoader& loader, std::uint64_t id) {
+            auto ref = varint(id);
+            if (!ref) {
+                return nullptr;
+            }
+            return loader.transform_context().statement_repository().get(ebm::StatementRef{*ref});
+        }
+
+        ebm::Expression* get_expression(TestContextLoader& loader, std::uint64_t id) {
+            auto ref = varint(id);
+            if (!ref) {
+                return nullptr;
+            }
+            return loader.transform_context().expression_repository().get(ebm::ExpressionRef{*ref});
+        }
+
+        ebm::Block* get_block(TestContextLoader& loader, std::uint64_t id) {
+            auto stmt = get_statement(loader, id);
+            return stmt ? stmt->body.block() : nullptr;
+        }
+
+        // initial value of variable defined by statement ref
+        std::uint64_t initial_value_of(TestContextLoader& loader, ebm::StatementRef ref) {
+            auto stmt = get_statement(loader, get_id(ref));
+            if (!stmt || !stmt->body.var_decl()) {
+                return 0;
+            }
+            return get_id(stmt->body.var_decl()->initial_value);
+        }
+
+        void load_and_run(TestContextLoader& loader, std::string_view name, auto&& pass) {
+            auto loaded = loader.load_json_ebm_file(fixture(name));
+            ASSERT_TRUE(loaded) << loaded.error().error<std::string>();
+            auto result = pass(loader.transform_context());
+            ASSERT_TRUE(result) << result.error().error<std::string>();
+        }
+    }  // namespace
+
+    TEST(LoadJsonEbm, StreamAndDomDecodeSameModule) {
+        for (auto name : {"cse_place_operand.json", "licm_conditional_body.json", "licm_for_each.json", "fixed_layout_decode.json", "vectorized_io.json"}) {
+            SCOPED_TRACE(name);
+            auto stream = load_json_ebm(fixture(name));
+            ASSERT_TRUE(stream) << stream.error().error<std::string>();
+            auto dom = load_json_ebm(fixture(name), true);
+            ASSERT_TRUE(dom) << dom.error().error<std::string>();
+            std::string stream_bytes, dom_bytes;
+            futils::binary::writer stream_w{futils::binary::resizable_buffer_writer<std::string>(), &stream_bytes};
+            futils::binary::writer dom_w{futils::binary::resizable_buffer_writer<std::string>(), &dom_bytes};
+            ASSERT_FALSE(stream->encode(stream_w));
+            ASSERT_FALSE(dom->encode(dom_w));
+            EXPECT_EQ(stream_bytes, dom_bytes);
+        }
+    }
+
+    TEST(LoadJsonEbm, StreamErrorIsReported) {
+        // stream decoder does not fall back to DOM decoder
+        std::string_view truncated = R"({"version": 1, "max_id": )";
+        auto result = decode_json_ebm(futils::view::rvec(truncated.data(), truncated.size()));
+        EXPECT_FALSE(result);
+    }
+
+    TEST(CommonSubexpressionElimination, PlaceOperandAndConstant) {
+        TestContextLoader loader;
+        ASSERT_NO_FATAL_FAILURE(load_and_run(loader, "cse_place_operand.json", common_subexpression_elimination));
+
+        // no temporary is introduced: 4 * 2 is constant and self.inner.len is written through address at 12
+        auto block = get_block(loader, 10);
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ(block->container.size(), 3);
+
+        // as_arg(&self.inner.len) is kept as is
+        auto call = get_statement(loader, 12);
+        ASSERT_NE(call, nullptr);
+        ASSERT_NE(call->body.expression(), nullptr);
+        EXPECT_EQ(get_id(*call->body.expression()), 110);
+        for (auto id : {11, 13}) {
+            auto decl = get_statement(loader, id);
+            ASSERT_NE(decl, nullptr);
+            ASSERT_NE(decl->body.var_decl(), nullptr);
+            EXPECT_EQ(get_id(decl->body.var_decl()->initial_value), 106);
+        }
+    }
+
+    TEST(LoopInvariantCodeMotion, ConditionalBody) {
+        TestContextLoader loader;
+        ASSERT_NO_FATAL_FAILURE(load_and_run(loader, "licm_conditional_body.json", loop_invariant_code_motion));
+
+        // self.hdr.len in loop condition is hoisted just before loop 11
+        auto block = get_block(loader, 10);
+        ASSERT_NE(block, nullptr);
+        ASSERT_EQ(block->container.size(), 5);
+        EXPECT_EQ(get_id(block->container[4]), 11);
+        EXPECT_EQ(initial_value_of(loader, block->container[3]), 102);
+        auto loop = get_statement(loader, 11);
+        ASSERT_NE(loop, nullptr);
+        ASSERT_NE(loop->body.loop(), nullptr);
+        EXPECT_NE(get_id(loop->body.loop()->condition()->cond), 105);
+
+        // self.hdr.data[0] as u32 in conditional branch is kept
+        auto assign = get_statement(loader, 17);
+        ASSERT_NE(assign, nullptr);
+        EXPECT_EQ(get_id(*assign->body.value()), 109);
+
+        // break still refers loop itself
+        auto brk = get_statement(loader, 16);
+        ASSERT_NE(brk, nullptr);
+        ASSERT_NE(brk->body.break_(), nullptr);
+        EXPECT_EQ(get_id(brk->body.break_()->related_statement), 11);
+    }
+
+    TEST(LoopInvariantCodeMotion, ForEachLoweredLoop) {
+        TestContextLoader loader;
+        ASSERT_NO_FATAL_FAILURE(load_and_run(loader, "licm_for_each.json", loop_invariant_code_motion));
+
+        // array_size(self.data) of lowered condition and self.hdr.len of body are hoisted before for-each loop 11
+        auto block = get_block(loader, 10);
+        ASSERT_NE(block, nullptr);
+        ASSERT_EQ(block->container.size(), 6);
+        EXPECT_EQ(get_id(block->container[5]), 11);
+        std::set<std::uint64_t> hoisted{initial_value_of(loader, block->container[3]), initial_value_of(loader, block->container[4])};
+        EXPECT_EQ(hoisted, (std::set<std::uint64_t>{102, 107}));
+
+        auto lowered = get_statement(loader, 12);
+        ASSERT_NE(lowered, nullptr);
+        ASSERT_NE(lowered->body.loop(), nullptr);
+        EXPECT_NE(get_id(lowered->body.loop()->condition()->cond), 130);
+        auto assign = get_statement(loader, 17);
+        ASSERT_NE(assign, nullptr);
+        EXPECT_NE(get_id(*assign->body.value()), 102);
+
+        // array_size(self.out) is not hoisted because self.out is appended in loop
+        auto size = get_statement(loader, 19);
+        ASSERT_NE(size, nullptr);
+        EXPECT_EQ(get_id(*size->body.value()), 117);
+    }
+
+    TEST(FixedLayoutStruct, DecodeWithAssert) {
+        TestContextLoader loader;
+        ASSERT_NO_FATAL_FAILURE(load_and_run(loader, "fixed_layout_decode.json", fixed_layout_struct));
+
+        // Hdr is read by FIXED_LAYOUT_DECODE and original STRUCT_CALL is kept as last representation
+        auto read = get_statement(loader, 21);
+        ASSERT_NE(read, nullptr);
+        ASSERT_NE(read->body.read_data(), nullptr);
+        auto low = read->body.read_data()->lowered_statement();
+        ASSERT_NE(low, nullptr);
+        ASSERT_EQ(low->lowering_type, ebm::LoweringIOType::MULTI_REPRESENTATION);
+        auto multi = get_statement(loader, get_id(low->io_statement.id));
+        ASSERT_NE(multi, nullptr);
+        auto lows = multi->body.lowered_io_statements();
+        ASSERT_NE(lows, nullptr);
+        ASSERT_EQ(lows->container.size(), 2);
+        EXPECT_EQ(lows->container[0].lowering_type, ebm::LoweringIOType::FIXED_LAYOUT_DECODE);
+        EXPECT_EQ(lows->container[1].lowering_type, ebm::LoweringIOType::STRUCT_CALL);
+        EXPECT_EQ(get_id(lows->container[1].io_statement.id), 22);
+
+        // init check of STRUCT_CALL comes first and assert on hdr.b comes last
+        auto block = get_block(loader, get_id(lows->container[0].io_statement.id));
+        ASSERT_NE(block, nullptr);
+        ASSERT_GE(block->container.size(), 3);
+        EXPECT_EQ(get_id(block->container[0]), 23);
+        auto assert_stmt = get_statement(loader, get_id(block->container.back()));
+        ASSERT_NE(assert_stmt, nullptr);
+        ASSERT_NE(assert_stmt->body.assert_desc(), nullptr);
+        auto cond = get_expression(loader, get_id(assert_stmt->body.assert_desc()->condition.cond));
+        ASSERT_NE(cond, nullptr);
+        ASSERT_NE(cond->body.left(), nullptr);
+        auto left = get_expression(loader, get_id(*cond->body.left()));
+        ASSERT_NE(left, nullptr);
+        ASSERT_NE(left->body.base(), nullptr);
+        EXPECT_EQ(get_id(*left->body.base()), 110);
+
+        // assert of Param refers parameter of decode function, so Param is decoded by function call
+        auto param_read = get_statement(loader, 25);
+        ASSERT_NE(param_read, nullptr);
+        ASSERT_NE(param_read->body.read_data(), nullptr);
+        auto param_low = param_read->body.read_data()->lowered_statement();
+        ASSERT_NE(param_low, nullptr);
+        EXPECT_EQ(param_low->lowering_type, ebm::LoweringIOType::STRUCT_CALL);
+    }
+
+    TEST(VectorizedIO, ReadGroupsStopAtCustomCodedStruct) {
+        TestContextLoader loader;
+        ASSERT_NO_FATAL_FAILURE(load_and_run(loader, "vectorized_io.json", [](TransformContext& tctx) {
+            return vectorized_io(tctx, false);
+        }));
+
+        // body of decode function is replaced by block with vectorized reads
+        auto func = get_statement(loader, 5);
+        ASSERT_NE(func, nullptr);
+        ASSERT_NE(func->body.func_decl(), nullptr);
+        auto block = get_block(loader, get_id(func->body.func_decl()->body));
+        ASSERT_NE(block, nullptr);
+        ASSERT_EQ(block->container.size(), 4);
+        EXPECT_EQ(get_id(block->container[1]), 15);  // array of Custom is not fixed size
+        EXPECT_EQ(get_id(block->container[3]), 14);
+
+        auto check_group = [&](ebm::StatementRef ref, std::uint64_t bytes, std::vector<std::uint64_t> original) {
+            auto read = get_statement(loader, get_id(ref));
+            ASSERT_NE(read, nullptr);
+            auto io = read->body.read_data();
+            ASSERT_NE(io, nullptr);
+            EXPECT_EQ(io->size.unit, ebm::SizeUnit::BYTE_FIXED);
+            ASSERT_NE(io->size.size(), nullptr);
+            EXPECT_EQ(io->size.size()->value(), bytes);
+            auto low = io->lowered_statement();
+            ASSERT_NE(low, nullptr);
+            EXPECT_EQ(low->lowering_type, ebm::LoweringIOType::VECTORIZED_IO);
+            auto group = get_block(loader, get_id(low->io_statement.id));
+            ASSERT_NE(group, nullptr);
+            ASSERT_EQ(group->container.size(), original.size());
+            for (size_t i = 0; i < original.size(); i++) {
+                EXPECT_EQ(get_id(group->container[i]), original[i]);
+            }
+        };
+        check_group(block->container[0], 3, {11, 12});
+        check_group(block->container[2], 6, {16, 13});
+    }
+}  // namespace ebmgen
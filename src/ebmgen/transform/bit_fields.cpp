@@ -381,6 +381,28 @@ namespace ebmgen {
             EBMA_ADD_STATEMENT(flush_stmt, flush_buffer_statement, std::move(write_data));
             return flush_stmt;
         };
+        // if whole route is read upfront and fits in a word with same static endian,
+        // load the word once and extract each field by shift and mask
+        std::optional<WordBitExtractor> word_extractor;
+        if (!write && is_single_route && max_bit_size <= 64) {
+            std::optional<ebm::Endian> route_endian;
+            bool same_endian = true;
+            for (auto& c : finalized_routes[0].route) {
+                MAYBE(stmt, tctx.tctx.statement_repository().get(c->original_node));
+                if (auto io_ = get_io(stmt, write)) {
+                    auto endian = io_->attribute.endian();
+                    if ((endian != ebm::Endian::little && endian != ebm::Endian::big) ||
+                        (route_endian && *route_endian != endian)) {
+                        same_endian = false;
+                        break;
+                    }
+                    route_endian = endian;
+                }
+            }
+            if (same_endian && route_endian) {
+                word_extractor.emplace(ctx, tmp_buffer, u8_t, max_bit_size, *route_endian);
+            }
+        }
         std::set<std::shared_ptr<CFG>> reached_route;
         for (auto& r : finalized_routes) {
             BitManipulator extractor(ctx, tmp_buffer, u8_t);
@@ -419,8 +441,18 @@ namespace ebmgen {
                         // if (!write) {
                         //    append(block, read_offset_def);
                         //}
+                        if (word_extractor) {
+                            MAYBE(load_word, word_extractor->load_word());
+                            append(block, load_word);
+                        }
                     }
-                    if (!write) {
+                    if (word_extractor) {
+                        MAYBE(extracted, word_extractor->extract(current_bit_offset, bit_size, unsigned_t));
+                        EBM_CAST(casted, io_copy.data_type, unsigned_t, extracted);
+                        EBM_ASSIGNMENT(fin, io_copy.target, casted);
+                        append(block, fin);
+                    }
+                    else if (!write) {
                         MAYBE(io_cond, do_incremental(from_weak(io_copy.field), read_offset, new_size_bit));
                         EBM_DEFAULT_VALUE(zero, unsigned_t);
                         EBM_DEFINE_ANONYMOUS_VARIABLE(tmp_holder, unsigned_t, zero);
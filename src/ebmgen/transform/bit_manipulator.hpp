@@ -170,4 +170,32 @@ namespace ebmgen {
         ConverterContext& ctx;
         ebm::ExpressionRef tmp_buffer_;
     };
+
+    // reads whole bit field group as one word and extracts each field by single shift and mask
+    // instead of assembling each field from bytes like BitManipulator::read_bits
+    // word = buffer[0..word_bit_size/8] (assembled once by endian)
+    // field = (word >> shift) & mask
+    //   shift = big ? word_bit_size - bit_offset - bit_size : bit_offset
+    //   mask = (1 << bit_size) - 1
+    // shift and mask are computed here so generated code has only constants
+    struct WordBitExtractor {
+       public:
+        WordBitExtractor(ConverterContext& ctx, ebm::ExpressionRef buffer, ebm::TypeRef u8_type, size_t word_bit_size, ebm::Endian endian)
+            : ctx(ctx), buffer_(buffer), u8_type(u8_type), word_bit_size(word_bit_size), endian(endian) {}
+
+        // define word variable and load it from buffer
+        // must be called before extract
+        expected<ebm::StatementRef> load_word();
+
+        expected<ebm::ExpressionRef> extract(size_t bit_offset, size_t bit_size, ebm::TypeRef target_type);
+
+       private:
+        ConverterContext& ctx;
+        ebm::ExpressionRef buffer_;
+        ebm::TypeRef u8_type;
+        size_t word_bit_size = 0;
+        ebm::Endian endian;
+        ebm::TypeRef word_type;
+        ebm::ExpressionRef word;
+    };
 }  // namespace ebmgen
\ No newline at end of file
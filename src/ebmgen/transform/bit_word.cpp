@@ -0,0 +1,58 @@
+/*license*/
+#include "bit_manipulator.hpp"
+#include "../convert/helper.hpp"
+#include "ebmgen/converter.hpp"
+
+namespace ebmgen {
+    // smallest common integer size covering n bits
+    static size_t covering_word_size(size_t n) {
+        for (size_t w : {8, 16, 32, 64}) {
+            if (n <= w) {
+                return w;
+            }
+        }
+        return n;
+    }
+
+    expected<ebm::StatementRef> WordBitExtractor::load_word() {
+        if (endian != ebm::Endian::little && endian != ebm::Endian::big) {
+            return unexpect_error("WordBitExtractor requires static endian but got {}", to_string(endian));
+        }
+        EBMU_UINT_TYPE(word_t, covering_word_size(word_bit_size));
+        EBM_DEFAULT_VALUE(zero, word_t);
+        EBM_DEFINE_ANONYMOUS_VARIABLE(word_var, word_t, zero);
+        BitManipulator loader(ctx, buffer_, u8_type);
+        MAYBE(load, loader.read_bits(0, word_bit_size, endian, word_t, word_var));
+        word_type = word_t;
+        word = word_var;
+        ebm::Block block;
+        append(block, word_var_def);
+        append(block, load);
+        EBM_BLOCK(loaded, std::move(block));
+        return loaded;
+    }
+
+    expected<ebm::ExpressionRef> WordBitExtractor::extract(size_t bit_offset, size_t bit_size, ebm::TypeRef target_type) {
+        if (is_nil(word)) {
+            return unexpect_error("word is not loaded");
+        }
+        if (bit_offset + bit_size > word_bit_size) {
+            return unexpect_error("bit field out of word: offset={} size={} word={}", bit_offset, bit_size, word_bit_size);
+        }
+        const size_t shift = endian == ebm::Endian::big ? word_bit_size - bit_offset - bit_size : bit_offset;
+        auto expr = word;
+        if (shift != 0) {
+            EBMU_INT_LITERAL(shift_lit, shift);
+            EBM_BINARY_OP(shifted, ebm::BinaryOp::right_shift, word_type, expr, shift_lit);
+            expr = shifted;
+        }
+        if (shift + bit_size < word_bit_size) {  // upper bits of word are always zero
+            const std::uint64_t mask = bit_size >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bit_size) - 1;
+            EBMU_INT_LITERAL(mask_lit, mask);
+            EBM_BINARY_OP(masked, ebm::BinaryOp::bit_and, word_type, expr, mask_lit);
+            expr = masked;
+        }
+        EBM_CAST(casted, target_type, word_type, expr);
+        return casted;
+    }
+}  // namespace ebmgen
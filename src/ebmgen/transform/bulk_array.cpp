@@ -0,0 +1,120 @@
+/*license*/
+#include "ebm/extended_binary_module.hpp"
+#include "transform.hpp"
+#include "pure_expression.hpp"
+#include "../convert/helper.hpp"
+
+namespace ebmgen {
+
+    // element type that can be copied as raw bytes and byte-swapped in place
+    expected<std::optional<std::uint64_t>> get_bulk_element_size(TransformContext& tctx, ebm::TypeRef array_type) {
+        MAYBE(typ, tctx.type_repository().get(array_type));
+        if (typ.body.kind != ebm::TypeKind::ARRAY && typ.body.kind != ebm::TypeKind::VECTOR) {
+            return std::nullopt;
+        }
+        MAYBE(element_type, typ.body.element_type());
+        MAYBE(elem, tctx.type_repository().get(element_type));
+        if (elem.body.kind != ebm::TypeKind::INT && elem.body.kind != ebm::TypeKind::UINT && elem.body.kind != ebm::TypeKind::FLOAT) {
+            return std::nullopt;
+        }
+        auto size = elem.body.size()->value();
+        if (size != 16 && size != 32 && size != 64) {
+            return std::nullopt;  // u8 array is already handled as bytes
+        }
+        return size;
+    }
+
+    // ARRAY_FOR_EACH lowering with counter loop (not until-eof or terminator loop)
+    // returns io attribute of element
+    expected<std::optional<ebm::IOAttribute>> find_counted_element_io(TransformContext& tctx, ebm::StatementRef lowered, ebm::TypeRef element_type) {
+        MAYBE(stmt, tctx.statement_repository().get(lowered));
+        auto loop_ref = lowered;
+        if (auto block = stmt.body.block()) {
+            if (block->container.empty()) {
+                return std::nullopt;
+            }
+            loop_ref = block->container.back();
+        }
+        MAYBE(loop_stmt, tctx.statement_repository().get(loop_ref));
+        auto loop = loop_stmt.body.loop();
+        if (!loop || loop->loop_type != ebm::LoopType::FOR) {
+            return std::nullopt;
+        }
+        MAYBE(nested, collect_nested_statements(tctx, loop->body, false));
+        std::optional<ebm::IOAttribute> attribute;
+        for (auto& ref : nested.order) {
+            MAYBE(s, tctx.statement_repository().get(ref));
+            auto io = s.body.read_data() ? s.body.read_data() : s.body.write_data();
+            if (!io) {
+                continue;
+            }
+            if (io->data_type != element_type || attribute) {
+                return std::nullopt;  // not a simple element loop
+            }
+            attribute = io->attribute;
+        }
+        return attribute;
+    }
+
+    expected<void> bulk_primitive_array_io(TransformContext& tctx) {
+        auto& all_statements = tctx.statement_repository().get_all();
+        const auto current_added = all_statements.size();
+        size_t lowered_count = 0;
+        for (size_t i = 0; i < current_added; i++) {
+            auto& stmt = tctx.statement_repository().get_all()[i];
+            auto io = stmt.body.read_data() ? stmt.body.read_data() : stmt.body.write_data();
+            if (!io) {
+                continue;
+            }
+            auto low = io->lowered_statement();
+            if (!low || low->lowering_type != ebm::LoweringIOType::ARRAY_FOR_EACH) {
+                continue;
+            }
+            if (io->size.unit != ebm::SizeUnit::ELEMENT_FIXED && io->size.unit != ebm::SizeUnit::ELEMENT_DYNAMIC) {
+                continue;
+            }
+            MAYBE(element_size, get_bulk_element_size(tctx, io->data_type));
+            if (!element_size) {
+                continue;
+            }
+            const auto stmt_id = stmt.id;
+            const auto kind = stmt.body.kind;
+            const auto io_copy = *io;
+            const auto original_lowering = *low;
+            MAYBE(typ, tctx.type_repository().get(io_copy.data_type));
+            MAYBE(element_type, typ.body.element_type());
+            MAYBE(attribute, find_counted_element_io(tctx, original_lowering.io_statement.id, element_type));
+            if (!attribute || attribute->endian() == ebm::Endian::unspec) {
+                continue;
+            }
+            auto& ctx = tctx.context();
+            // descriptor of bulk io; target, type and count are same as original
+            // but attribute describes element endian and no lowering is attached
+            auto desc = io_copy;
+            desc.attribute = *attribute;
+            desc.attribute.has_lowered_statement(false);
+            desc.attribute.has_offset(io_copy.attribute.has_offset());
+            ebm::StatementBody bulk_body;
+            bulk_body.kind = kind;
+            if (kind == ebm::StatementKind::READ_DATA) {
+                bulk_body.read_data(std::move(desc));
+            }
+            else {
+                bulk_body.write_data(std::move(desc));
+            }
+            EBMA_ADD_STATEMENT(bulk, std::move(bulk_body));
+            // keep original ARRAY_FOR_EACH as last (default) representation
+            ebm::LoweredIOStatements lows;
+            append(lows, make_lowered_statement(ebm::LoweringIOType::BULK_PRIMITIVE_ARRAY, bulk));
+            append(lows, original_lowering);
+            EBM_LOWERED_IO_STATEMENTS(l, std::move(lows));
+            MAYBE(stmt_ptr, tctx.statement_repository().get(stmt_id));  // refetch because memory is relocated
+            auto io_ = stmt_ptr.body.read_data() ? stmt_ptr.body.read_data() : stmt_ptr.body.write_data();
+            io_->lowered_statement(make_lowered_statement(ebm::LoweringIOType::MULTI_REPRESENTATION, l));
+            lowered_count++;
+        }
+        print_if_verbose("Bulk primitive array io: ", lowered_count, "\n");
+        return {};
+    }
+
+}  // namespace ebmgen
@@ -0,0 +1,322 @@
+/*license*/
+#include "transform.hpp"
+#include "pure_expression.hpp"
+#include "../convert/helper.hpp"
+#include <algorithm>
+
+namespace ebmgen {
+
+    // expression worth holding in temporary variable
+    // single identifier, literal and single member access are cheap enough to re-evaluate
+    expected<bool> is_cse_candidate(TransformContext& tctx, ebm::ExpressionRef ref) {
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        switch (expr.body.kind) {
+            case ebm::ExpressionKind::MEMBER_ACCESS: {
+                MAYBE(base, tctx.expression_repository().get(*expr.body.base()));
+                if (base.body.kind != ebm::ExpressionKind::MEMBER_ACCESS) {
+                    return false;
+                }
+                break;
+            }
+            case ebm::ExpressionKind::ARRAY_SIZE:
+                break;
+            case ebm::ExpressionKind::BINARY_OP: {
+                switch (*expr.body.bop()) {
+                    case ebm::BinaryOp::mul:
+                    case ebm::BinaryOp::div:
+                    case ebm::BinaryOp::mod:
+                    case ebm::BinaryOp::left_shift:
+                    case ebm::BinaryOp::right_shift:
+                    case ebm::BinaryOp::bit_and:
+                    case ebm::BinaryOp::add:
+                    case ebm::BinaryOp::sub:
+                    case ebm::BinaryOp::bit_or:
+                    case ebm::BinaryOp::bit_xor:
+                        break;
+                    default:
+                        return false;
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+        return is_pure_expression(tctx, ref, false);
+    }
+
+    struct CSEContext {
+        TransformContext& tctx;
+        const CFGStack& stack;
+        const DominatorTree& dom_tree;
+        FunctionStatements statements;
+        std::unordered_map<std::uint64_t, size_t>& ref_counts;
+        std::unordered_map<std::uint64_t, std::unordered_set<std::uint64_t>> contained;  // statement -> eagerly evaluated expressions
+        std::unordered_map<std::uint64_t, StatementEffect> effects;
+
+        std::shared_ptr<CFG> node_of(ebm::StatementRef ref) const {
+            auto found = stack.cfg_map.find(get_id(ref));
+            if (found == stack.cfg_map.end()) {
+                return nullptr;
+            }
+            return found->second;
+        }
+
+        expected<const StatementEffect*> effect_of(ebm::StatementRef ref) {
+            auto found = effects.find(get_id(ref));
+            if (found == effects.end()) {
+                MAYBE(effect, get_statement_effect(tctx, ref));
+                found = effects.emplace(get_id(ref), std::move(effect)).first;
+            }
+            return &found->second;
+        }
+
+        expected<void> update_contained(ebm::StatementRef ref) {
+            MAYBE(stmt, tctx.statement_repository().get(ref));
+            std::vector<ebm::ExpressionRef> slots;
+            for (auto slot : value_slots(stmt.body)) {
+                slots.push_back(*slot);
+            }
+            auto& set = contained[get_id(ref)];
+            set.clear();
+            for (auto& slot : slots) {
+                MAYBE_VOID(ok, collect_eager_subexpressions(tctx, slot, set));
+            }
+            return {};
+        }
+
+        // block statement directly containing ref and index of ref in it
+        expected<std::optional<std::pair<ebm::StatementRef, size_t>>> position_in_block(ebm::StatementRef ref) {
+            auto parent = statements.parent.find(get_id(ref));
+            if (parent == statements.parent.end()) {
+                return std::nullopt;
+            }
+            MAYBE(parent_stmt, tctx.statement_repository().get(parent->second));
+            auto block = parent_stmt.body.block();
+            if (!block) {
+                return std::nullopt;
+            }
+            auto it = std::find(block->container.begin(), block->container.end(), ref);
+            if (it == block->container.end()) {
+                return std::nullopt;
+            }
+            return std::make_pair(parent->second, size_t(it - block->container.begin()));
+        }
+
+        // temporary variable defined just before def is visible at use
+        expected<bool> is_visible(ebm::StatementRef def, ebm::StatementRef use) {
+            MAYBE(def_pos, position_in_block(def));
+            if (!def_pos) {
+                return false;
+            }
+            auto current = use;
+            while (true) {
+                auto parent = statements.parent.find(get_id(current));
+                if (parent == statements.parent.end()) {
+                    return false;
+                }
+                if (parent->second == def_pos->first) {
+                    break;
+                }
+                current = parent->second;
+            }
+            MAYBE(use_pos, position_in_block(current));
+            return use_pos && use_pos->second > def_pos->second;
+        }
+
+        // nodes reached from def through a statement killing ids (paths through def itself are not followed)
+        // computed once per definition instead of walking nodes_between(def, use) for each use
+        expected<std::unordered_set<std::shared_ptr<CFG>>> killed_after(const std::shared_ptr<CFG>& def_node, const std::unordered_set<std::uint64_t>& ids) {
+            std::unordered_set<std::shared_ptr<CFG>> reached, killed;
+            std::vector<std::shared_ptr<CFG>> stack{def_node->next.begin(), def_node->next.end()}, kill_stack;
+            while (!stack.empty()) {
+                auto n = std::move(stack.back());
+                stack.pop_back();
+                if (n == def_node || !reached.insert(n).second) {
+                    continue;
+                }
+                stack.insert(stack.end(), n->next.begin(), n->next.end());
+                if (is_nil(n->original_node)) {
+                    continue;  // <phi>
+                }
+                MAYBE(effect, effect_of(n->original_node));
+                if (effect.kills(ids)) {
+                    kill_stack.insert(kill_stack.end(), n->next.begin(), n->next.end());
+                }
+            }
+            while (!kill_stack.empty()) {
+                auto n = std::move(kill_stack.back());
+                kill_stack.pop_back();
+                if (n == def_node || !killed.insert(n).second) {
+                    continue;
+                }
+                kill_stack.insert(kill_stack.end(), n->next.begin(), n->next.end());
+            }
+            return killed;
+        }
+
+        // value of expression computed at def is still valid at use
+        // killed is result of killed_after(def)
+        expected<bool> is_available(ebm::StatementRef def, ebm::StatementRef use, const std::unordered_set<std::shared_ptr<CFG>>& killed) {
+            auto def_node = node_of(def);
+            auto use_node = node_of(use);
+            if (!def_node || !use_node || !dominates(dom_tree, def_node, use_node)) {
+                return false;
+            }
+            MAYBE(visible, is_visible(def, use));
+            if (!visible) {
+                return false;
+            }
+            return !killed.contains(use_node);
+        }
+
+        expected<void> replace_in_statement(ebm::StatementRef ref, ebm::ExpressionRef from, ebm::ExpressionRef to) {
+            MAYBE(stmt, tctx.statement_repository().get(ref));
+            std::vector<ebm::ExpressionRef> slots;
+            for (auto slot : value_slots(stmt.body)) {
+                slots.push_back(*slot);
+            }
+            for (auto& slot : slots) {
+                MAYBE(replaced, replace_expression(tctx, slot, from, to));
+                slot = replaced;
+            }
+            MAYBE(stmt_ptr, tctx.statement_repository().get(ref));  // refetch because memory may be relocated
+            auto new_slots = value_slots(stmt_ptr.body);
+            for (size_t i = 0; i < new_slots.size(); i++) {
+                *new_slots[i] = slots[i];
+            }
+            return update_contained(ref);
+        }
+
+        // T = expr
+        // def(... T ...)
+        // ...
+        // use(... T ...)
+        expected<void> eliminate(ebm::ExpressionRef expr_ref, ebm::StatementRef def, const std::vector<ebm::StatementRef>& uses) {
+            auto& ctx = tctx.context();
+            MAYBE(expr, tctx.expression_repository().get(expr_ref));
+            const auto typ = expr.body.type;
+            EBM_DEFINE_VARIABLE(tmp, {}, typ, expr_ref, ebm::VariableDeclKind::IMMUTABLE, false);
+            MAYBE_VOID(def_replaced, replace_in_statement(def, expr_ref, tmp));
+            for (auto& use : uses) {
+                MAYBE_VOID(use_replaced, replace_in_statement(use, expr_ref, tmp));
+            }
+            MAYBE(def_pos, position_in_block(def));
+            if (!def_pos) {
+                return unexpect_error("CSE: definition statement {} is not in block", get_id(def));
+            }
+            MAYBE(parent, tctx.statement_repository().get(def_pos->first));
+            MAYBE(block, parent.body.block());
+            block.container.insert(block.container.begin() + def_pos->second, tmp_def);
+            block.len = varint(block.container.size()).value();
+            statements.parent[get_id(tmp_def)] = def_pos->first;
+            return {};
+        }
+
+        expected<size_t> run() {
+            std::vector<ebm::StatementRef> targets;
+            for (auto& ref : statements.order) {
+                // shared statements are placed at multiple positions, so cannot be rewritten in place
+                if (ref_counts[get_id(ref)] != 1 || !node_of(ref)) {
+                    continue;
+                }
+                auto parent = statements.parent.find(get_id(ref));
+                if (parent == statements.parent.end() || ref_counts[get_id(parent->second)] != 1) {
+                    continue;
+                }
+                MAYBE_VOID(ok, update_contained(ref));
+                if (contained[get_id(ref)].size()) {
+                    targets.push_back(ref);
+                }
+            }
+            std::unordered_map<std::uint64_t, std::vector<ebm::StatementRef>> occurrences;
+            for (auto& ref : targets) {
+                for (auto& e : contained[get_id(ref)]) {
+                    occurrences[e].push_back(ref);
+                }
+            }
+            std::vector<std::pair<size_t, ebm::ExpressionRef>> candidates;
+            for (auto& [e, occ] : occurrences) {
+                if (occ.size() < 2) {
+                    continue;
+                }
+                MAYBE(id, varint(e));
+                ebm::ExpressionRef ref{id};
+                MAYBE(ok, is_cse_candidate(tctx, ref));
+                if (ok) {
+                    candidates.emplace_back(expression_size(tctx, ref), ref);
+                }
+            }
+            // larger expression first so that its sub expressions are also eliminated at once
+            std::sort(candidates.begin(), candidates.end(), [](auto& a, auto& b) {
+                return a.first != b.first ? a.first > b.first : a.second < b.second;
+            });
+            size_t eliminated = 0;
+            for (auto& [_, expr_ref] : candidates) {
+                std::unordered_set<std::uint64_t> ids;
+                MAYBE_VOID(collected, collect_identifiers(tctx, expr_ref, ids));
+                // constant expression is left to backend constant folding;
+                // holding it in temporary only adds a variable (and ids is empty so nothing could kill it)
+                if (ids.empty()) {
+                    continue;
+                }
+                std::vector<ebm::StatementRef> occ;
+                for (auto& ref : occurrences[get_id(expr_ref)]) {
+                    // may be already replaced by larger expression
+                    if (contained[get_id(ref)].contains(get_id(expr_ref))) {
+                        occ.push_back(ref);
+                    }
+                }
+                while (occ.size() >= 2) {
+                    auto def = occ.front();
+                    std::vector<ebm::StatementRef> uses, rest;
+                    MAYBE(def_effect, effect_of(def));
+                    auto def_node = node_of(def);
+                    if (def_node && !def_effect.kills(ids)) {
+                        MAYBE(killed, killed_after(def_node, ids));
+                        for (size_t i = 1; i < occ.size(); i++) {
+                            MAYBE(available, is_available(def, occ[i], killed));
+                            (available ? uses : rest).push_back(occ[i]);
+                        }
+                    }
+                    if (uses.empty()) {
+                        occ.erase(occ.begin());
+                        continue;
+                    }
+                    MAYBE_VOID(ok, eliminate(expr_ref, def, uses));
+                    eliminated++;
+                    occ = std::move(rest);
+                }
+            }
+            return eliminated;
+        }
+    };
+
+    expected<void> common_subexpression_elimination(TransformContext& tctx) {
+        CFGContext cfg_ctx{tctx};
+        MAYBE(cfg_list, analyze_control_flow_graph(cfg_ctx.stack, {&tctx.context().repository(), &tctx.statement_repository().get_all()}));
+        auto ref_counts = count_statement_references(tctx);
+        size_t eliminated = 0;
+        for (auto& [fn_id, result] : cfg_list.list) {
+            MAYBE(fn_ref_id, varint(fn_id));
+            MAYBE(fn, tctx.statement_repository().get(ebm::StatementRef{fn_ref_id}));
+            MAYBE(func_decl, fn.body.func_decl());
+            const auto body = func_decl.body;
+            if (is_nil(body)) {
+                continue;
+            }
+            MAYBE(statements, collect_function_statements(tctx, body));
+            CSEContext cse{
+                .tctx = tctx,
+                .stack = cfg_ctx.stack,
+                .dom_tree = result.dom_tree,
+                .statements = std::move(statements),
+                .ref_counts = ref_counts,
+            };
+            MAYBE(count, cse.run());
+            eliminated += count;
+        }
+        print_if_verbose("Common subexpression eliminated: ", eliminated, "\n");
+        return {};
+    }
+
+}  // namespace ebmgen
@@ -421,6 +421,52 @@ namespace ebmgen {
         return cfg_list;
     }
 
+    bool dominates(const DominatorTree& dom_tree, const std::shared_ptr<CFG>& dom, std::shared_ptr<CFG> node) {
+        while (node) {
+            if (node == dom) {
+                return true;
+            }
+            auto found = dom_tree.parent.find(node);
+            if (found == dom_tree.parent.end()) {
+                return false;
+            }
+            node = found->second;
+        }
+        return false;
+    }
+
+    std::set<std::shared_ptr<CFG>> nodes_between(const std::shared_ptr<CFG>& from, const std::shared_ptr<CFG>& to) {
+        std::set<std::shared_ptr<CFG>> forward, backward, result;
+        std::vector<std::shared_ptr<CFG>> stack{from->next.begin(), from->next.end()};
+        while (!stack.empty()) {
+            auto n = std::move(stack.back());
+            stack.pop_back();
+            if (n == from || !forward.insert(n).second) {
+                continue;
+            }
+            stack.insert(stack.end(), n->next.begin(), n->next.end());
+        }
+        for (auto& p : to->prev) {
+            if (auto l = p.lock()) {
+                stack.push_back(std::move(l));
+            }
+        }
+        while (!stack.empty()) {
+            auto n = std::move(stack.back());
+            stack.pop_back();
+            if (n == from || !backward.insert(n).second) {
+                continue;
+            }
+            for (auto& p : n->prev) {
+                if (auto l = p.lock()) {
+                    stack.push_back(std::move(l));
+                }
+            }
+        }
+        std::set_intersection(forward.begin(), forward.end(), backward.begin(), backward.end(), std::inserter(result, result.begin()));
+        return result;
+    }
+
     void write_cfg(futils::binary::writer& result, const CFGList& m, const MappingTable& ctx) {
         futils::code::CodeWriter<std::string> w;
         std::uint64_t id = 0;
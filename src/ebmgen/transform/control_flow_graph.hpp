@@ -2,6 +2,7 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <set>
 #include <ebm/extended_binary_module.hpp>
 #include "ebmgen/converter.hpp"
 #include "ebmgen/mapping.hpp"
@@ -95,5 +96,10 @@ namespace ebmgen {
     };
 
     expected<CFGList> analyze_control_flow_graph(CFGStack& stack, RepositoryProxy proxy);
+    // true if every path from root to node passes through dom
+    bool dominates(const DominatorTree& dom_tree, const std::shared_ptr<CFG>& dom, std::shared_ptr<CFG> node);
+    // nodes on some path from `from` to `to` that does not pass through `from` again
+    // `from` is excluded and `to` is included only if it is on a cycle not passing through `from`
+    std::set<std::shared_ptr<CFG>> nodes_between(const std::shared_ptr<CFG>& from, const std::shared_ptr<CFG>& to);
     void write_cfg(futils::binary::writer& w, const CFGList& m, const MappingTable& ctx);
 }  // namespace ebmgen
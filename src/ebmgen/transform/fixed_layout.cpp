@@ -0,0 +1,318 @@
+/*license*/
+#include "ebm/extended_binary_module.hpp"
+#include "transform.hpp"
+#include "../convert/helper.hpp"
+#include "bit_manipulator.hpp"
+#include "pure_expression.hpp"
+#include <unordered_map>
+
+namespace ebmgen {
+
+    struct FixedLayoutField {
+        ebm::StatementRef field;
+        ebm::ExpressionRef member;  // IDENTIFIER expression of field
+        ebm::TypeRef data_type;
+        ebm::IOAttribute attribute;
+        std::uint64_t bit_offset = 0;
+        std::uint64_t bit_size = 0;
+    };
+
+    struct FixedLayout {
+        std::uint64_t size = 0;  // in bytes
+        std::vector<FixedLayoutField> fields;
+        ebm::ExpressionRef self;                // SELF expression used as base of fields in decode function
+        std::vector<ebm::ExpressionRef> asserts;  // conditions checked after fields are read (refer fields through self)
+    };
+
+    // assert condition can be checked by caller if it depends only on fields and constants
+    expected<bool> is_layout_assert(TransformContext& tctx, ebm::ExpressionRef cond) {
+        MAYBE(side_effect, has_side_effect(tctx, cond));
+        if (side_effect) {
+            return false;
+        }
+        std::unordered_set<std::uint64_t> ids;
+        MAYBE_VOID(collected, collect_identifiers(tctx, cond, ids));
+        for (auto id : ids) {
+            MAYBE(ref, varint(id));
+            MAYBE(def, tctx.statement_repository().get(ebm::StatementRef{ref}));
+            if (def.body.kind == ebm::StatementKind::FIELD_DECL || def.body.kind == ebm::StatementKind::ENUM_MEMBER_DECL) {
+                continue;
+            }
+            auto var = def.body.var_decl();
+            if (var && var->decl_kind() == ebm::VariableDeclKind::CONSTANT) {
+                continue;
+            }
+            return false;  // local variable or parameter of decode function
+        }
+        return true;
+    }
+
+    // fixed layout struct is a struct that
+    // - has BYTE_FIXED size
+    // - has generated decode function without state variables
+    // - decode function consists only of integer/enum reads into its fields at constant bit offsets
+    //   (optionally followed by asserts on fields, e.g. `magic :u32(0x1234)`) and final return
+    // so that decoding it is equivalent to reading whole bytes once and loading each field from constant offset
+    expected<std::optional<FixedLayout>> analyze_fixed_layout(TransformContext& tctx, const ebm::StructDecl& struct_decl) {
+        if (!struct_decl.is_fixed_size() || !struct_decl.has_encode_decode()) {
+            return std::nullopt;
+        }
+        auto size = struct_decl.size();
+        if (size->unit != ebm::SizeUnit::BYTE_FIXED) {
+            return std::nullopt;
+        }
+        MAYBE(decode_fn, tctx.statement_repository().get(*struct_decl.decode_fn()));
+        auto func_decl = decode_fn.body.func_decl();
+        if (!func_decl || func_decl->params.container.size() != 1) {
+            return std::nullopt;
+        }
+        FixedLayout layout;
+        layout.size = size->size()->value();
+        std::uint64_t offset = 0;
+        bool returned = false;
+        auto collect = [&](auto&& self, ebm::StatementRef ref) -> expected<bool> {
+            MAYBE(stmt, tctx.statement_repository().get(ref));
+            if (stmt.body.kind == ebm::StatementKind::METADATA) {
+                return true;
+            }
+            if (returned) {
+                return false;  // unreachable statement
+            }
+            if (auto block = stmt.body.block()) {
+                const auto container = block->container;  // copy because repository may be accessed recursively
+                for (auto& r : container) {
+                    MAYBE(ok, self(self, r));
+                    if (!ok) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            if (stmt.body.kind == ebm::StatementKind::RETURN) {
+                returned = true;
+                return true;
+            }
+            if (auto assert_ = stmt.body.assert_desc()) {
+                auto cond = assert_->condition.cond;
+                MAYBE(ok, is_layout_assert(tctx, cond));
+                if (!ok) {
+                    return false;
+                }
+                layout.asserts.push_back(cond);
+                return true;
+            }
+            auto read = stmt.body.read_data();
+            if (!read || read->attribute.is_peek() || read->attribute.has_offset()) {
+                return false;
+            }
+            auto endian = read->attribute.endian();
+            if (endian != ebm::Endian::big && endian != ebm::Endian::little && endian != ebm::Endian::native) {
+                return false;
+            }
+            MAYBE(typ, tctx.type_repository().get(read->data_type));
+            if (typ.body.kind != ebm::TypeKind::INT && typ.body.kind != ebm::TypeKind::UINT && typ.body.kind != ebm::TypeKind::ENUM) {
+                return false;
+            }
+            auto fixed = read->size.size();
+            if (!fixed || (read->size.unit != ebm::SizeUnit::BIT_FIXED && read->size.unit != ebm::SizeUnit::BYTE_FIXED)) {
+                return false;
+            }
+            std::uint64_t bit_size = fixed->value();
+            if (read->size.unit == ebm::SizeUnit::BYTE_FIXED) {
+                bit_size *= 8;
+            }
+            if (bit_size == 0 || bit_size > 64) {
+                return false;
+            }
+            MAYBE(target, tctx.expression_repository().get(read->target));
+            auto member = target.body.member();
+            auto base = target.body.base();
+            if (target.body.kind != ebm::ExpressionKind::MEMBER_ACCESS || !member || !base) {
+                return false;
+            }
+            MAYBE(base_expr, tctx.expression_repository().get(*base));
+            if (base_expr.body.kind != ebm::ExpressionKind::SELF || (!is_nil(layout.self) && layout.self != *base)) {
+                return false;
+            }
+            layout.self = *base;
+            layout.fields.push_back(FixedLayoutField{
+                .field = from_weak(read->field),
+                .member = *member,
+                .data_type = read->data_type,
+                .attribute = read->attribute,
+                .bit_offset = offset,
+                .bit_size = bit_size,
+            });
+            offset += bit_size;
+            return true;
+        };
+        MAYBE(ok, collect(collect, func_decl->body));
+        if (!ok || layout.fields.empty() || offset != layout.size * 8) {
+            return std::nullopt;
+        }
+        return layout;
+    }
+
+    expected<void> add_fixed_layout_metadata(TransformContext& tctx, const FixedLayout& layout) {
+        auto& ctx = tctx.context();
+        EBMA_ADD_IDENTIFIER(offset_name, "fixed_layout.bit_offset");
+        for (auto& f : layout.fields) {
+            EBMU_INT_LITERAL(offset_lit, f.bit_offset);
+            ebm::Metadata metadata;
+            metadata.name = offset_name;
+            append(metadata.values, offset_lit);
+            ebm::StatementBody body;
+            body.kind = ebm::StatementKind::METADATA;
+            body.metadata(std::move(metadata));
+            EBMA_ADD_STATEMENT(meta_ref, std::move(body));
+            MAYBE(field_stmt, tctx.statement_repository().get(f.field));  // fetch after add because memory may be relocated
+            auto field_decl = field_stmt.body.field_decl();
+            if (!field_decl) {
+                return unexpect_error("fixed layout field {} is not a field decl", get_id(f.field));
+            }
+            if (!field_decl->has_metadata()) {
+                field_decl->has_metadata(true);
+                field_decl->metadata(ebm::Block{});
+            }
+            append(*field_decl->metadata(), meta_ref);
+        }
+        return {};
+    }
+
+    // init_check(target) // if original STRUCT_CALL has it
+    // tmp_buffer = [0] * size
+    // read(tmp_buffer) // bounds check only once
+    // target.field1 = field_type1(load(tmp_buffer, offset1))
+    // target.field2 = field_type2(load(tmp_buffer, offset2))
+    // ...
+    // assert(cond1(target))
+    // ...
+    expected<ebm::StatementRef> lower_fixed_layout_decode(TransformContext& tctx, const ebm::IOData& io, const FixedLayout& layout, std::optional<ebm::StatementRef> init_check) {
+        auto& ctx = tctx.context();
+        EBMU_U8(u8_t);
+        EBMU_U8_N_ARRAY(buffer_t, layout.size, ebm::ArrayAnnotation::read_temporary);
+        EBM_DEFAULT_VALUE(default_buf_v, buffer_t);
+        EBM_DEFINE_ANONYMOUS_VARIABLE(tmp_buffer, buffer_t, default_buf_v);
+        ebm::Block block;
+        if (init_check) {
+            append(block, *init_check);
+        }
+        append(block, tmp_buffer_def);
+        {
+            ebm::Block read_bytes;
+            for (size_t i = 0; i < layout.size; i++) {
+                EBMU_INT_LITERAL(index, i);
+                EBM_INDEX(indexed, u8_t, tmp_buffer, index);
+                auto data = make_io_data(io.io_ref, from_weak(io.field), indexed, u8_t, {}, get_size(8));
+                MAYBE(lowered, ctx.get_decoder_converter().decode_multi_byte_int_with_fixed_array(io.io_ref, from_weak(io.field), 1, {}, indexed, u8_t));
+                data.attribute.has_lowered_statement(true);
+                data.lowered_statement(make_lowered_statement(ebm::LoweringIOType::INT_TO_BYTE_ARRAY, lowered));
+                EBM_READ_DATA(read_to_temporary, std::move(data));
+                append(read_bytes, read_to_temporary);
+            }
+            EBM_BLOCK(read_bytes_ref, std::move(read_bytes));
+            MAYBE(buffer_size, make_fixed_size(layout.size, ebm::SizeUnit::BYTE_FIXED));
+            auto data = make_io_data(io.io_ref, from_weak(io.field), tmp_buffer, buffer_t, {}, buffer_size);
+            data.attribute.has_lowered_statement(true);
+            data.lowered_statement(make_lowered_statement(ebm::LoweringIOType::ARRAY_FOR_EACH, read_bytes_ref));
+            EBM_READ_DATA(read_buffer, std::move(data));
+            append(block, read_buffer);
+        }
+        BitManipulator extractor(ctx, tmp_buffer, u8_t);
+        for (auto& f : layout.fields) {
+            EBMU_UINT_TYPE(unsigned_t, f.bit_size);
+            EBM_DEFAULT_VALUE(zero, unsigned_t);
+            EBM_DEFINE_ANONYMOUS_VARIABLE(tmp_holder, unsigned_t, zero);
+            auto assign = add_endian_specific(
+                ctx, f.attribute,
+                [&] -> expected<ebm::StatementRef> {
+                    return extractor.read_bits(f.bit_offset, f.bit_size, ebm::Endian::little, unsigned_t, tmp_holder);
+                },
+                [&] -> expected<ebm::StatementRef> {
+                    return extractor.read_bits(f.bit_offset, f.bit_size, ebm::Endian::big, unsigned_t, tmp_holder);
+                });
+            if (!assign) {
+                return unexpect_error(std::move(assign.error()));
+            }
+            EBM_MEMBER_ACCESS(field_access, f.data_type, io.target, f.member);
+            EBM_CAST(casted, f.data_type, unsigned_t, tmp_holder);
+            EBM_ASSIGNMENT(fin, field_access, casted);
+            append(block, tmp_holder_def);
+            append(block, *assign);
+            append(block, fin);
+        }
+        for (auto& cond : layout.asserts) {
+            MAYBE(replaced, replace_expression(tctx, cond, layout.self, io.target));
+            MAYBE(assert_stmt, assert_statement(ctx, replaced));
+            append(block, assert_stmt);
+        }
+        EBM_BLOCK(lowered, std::move(block));
+        return lowered;
+    }
+
+    expected<void> fixed_layout_struct(TransformContext& tctx) {
+        auto& all_statements = tctx.statement_repository().get_all();
+        const auto current_added = all_statements.size();
+        std::unordered_map<std::uint64_t, FixedLayout> layouts;
+        for (size_t i = 0; i < current_added; i++) {
+            auto& stmt = tctx.statement_repository().get_all()[i];
+            auto struct_decl = stmt.body.struct_decl();
+            if (!struct_decl) {
+                continue;
+            }
+            auto id = get_id(stmt.id);
+            MAYBE(layout, analyze_fixed_layout(tctx, *struct_decl));
+            if (!layout) {
+                continue;
+            }
+            print_if_verbose("Fixed layout struct: ", id, " size: ", layout->size, "\n");
+            layouts.emplace(id, std::move(*layout));
+        }
+        for (auto& [_, layout] : layouts) {
+            MAYBE_VOID(ok, add_fixed_layout_metadata(tctx, layout));
+        }
+        for (size_t i = 0; i < current_added; i++) {
+            auto& stmt = tctx.statement_repository().get_all()[i];
+            auto read = stmt.body.read_data();
+            if (!read || read->size.unit != ebm::SizeUnit::BYTE_FIXED) {
+                continue;
+            }
+            auto low = read->lowered_statement();
+            if (!low || low->lowering_type != ebm::LoweringIOType::STRUCT_CALL) {
+                continue;
+            }
+            MAYBE(typ, tctx.type_repository().get(read->data_type));
+            auto struct_id = typ.body.id();
+            if (typ.body.kind != ebm::TypeKind::STRUCT || !struct_id) {
+                continue;
+            }
+            auto found = layouts.find(get_id(*struct_id));
+            if (found == layouts.end()) {
+                continue;
+            }
+            const auto stmt_id = stmt.id;
+            const auto io_copy = *read;
+            const auto original_lowering = *low;
+            std::optional<ebm::StatementRef> init_check;
+            MAYBE(call_block, tctx.statement_repository().get(original_lowering.io_statement.id));
+            if (auto b = call_block.body.block(); b && !b->container.empty()) {
+                MAYBE(first, tctx.statement_repository().get(b->container[0]));
+                if (first.body.kind == ebm::StatementKind::INIT_CHECK) {
+                    init_check = b->container[0];
+                }
+            }
+            MAYBE(lowered, lower_fixed_layout_decode(tctx, io_copy, found->second, init_check));
+            auto& ctx = tctx.context();
+            // keep original STRUCT_CALL as last (default) representation
+            // because FIXED_LAYOUT_DECODE bypasses decode function and backends should opt in to it
+            ebm::LoweredIOStatements lows;
+            append(lows, make_lowered_statement(ebm::LoweringIOType::FIXED_LAYOUT_DECODE, lowered));
+            append(lows, original_lowering);
+            EBM_LOWERED_IO_STATEMENTS(l, std::move(lows));
+            MAYBE(stmt_ptr, tctx.statement_repository().get(stmt_id));  // refetch because memory is relocated
+            MAYBE(io_, stmt_ptr.body.read_data());
+            io_.lowered_statement(make_lowered_statement(ebm::LoweringIOType::MULTI_REPRESENTATION, l));
+        }
+        return {};
+    }
+}  // namespace ebmgen
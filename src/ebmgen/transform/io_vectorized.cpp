@@ -15,6 +15,73 @@ namespace ebmgen {
         return block;
     }
 
+    expected<std::optional<std::uint64_t>> get_fixed_bit_size(TransformContext& tctx, ebm::TypeRef type) {
+        MAYBE(typ, tctx.type_repository().get(type));
+        switch (typ.body.kind) {
+            case ebm::TypeKind::INT:
+            case ebm::TypeKind::UINT:
+            case ebm::TypeKind::FLOAT:
+                return typ.body.size()->value();
+            case ebm::TypeKind::ENUM: {
+                auto base = typ.body.base_type();
+                if (!base || is_nil(*base)) {
+                    return std::nullopt;
+                }
+                return get_fixed_bit_size(tctx, *base);
+            }
+            case ebm::TypeKind::ARRAY: {
+                MAYBE(elem, get_fixed_bit_size(tctx, *typ.body.element_type()));
+                if (!elem) {
+                    return std::nullopt;
+                }
+                return *elem * typ.body.length()->value();
+            }
+            case ebm::TypeKind::STRUCT: {
+                MAYBE(stmt, tctx.statement_repository().get(from_weak(*typ.body.id())));
+                auto struct_decl = stmt.body.struct_decl();
+                // converter does not mark format with custom encode/decode function as fixed size
+                if (!struct_decl || !struct_decl->is_fixed_size()) {
+                    return std::nullopt;
+                }
+                auto size = struct_decl->size();
+                if (size->unit == ebm::SizeUnit::BIT_FIXED) {
+                    return size->size()->value();
+                }
+                if (size->unit == ebm::SizeUnit::BYTE_FIXED) {
+                    return size->size()->value() * 8;
+                }
+                return std::nullopt;
+            }
+            default:
+                return std::nullopt;
+        }
+    }
+
+    // returns the total bit size of io if it is statically known
+    // struct calls are fixed when converter assigned BIT_FIXED/BYTE_FIXED to them
+    // and arrays with ELEMENT_FIXED size are fixed when their element type is fixed size
+    expected<std::optional<std::uint64_t>> get_fixed_io_bit_size(TransformContext& tctx, const ebm::IOData& io) {
+        switch (io.size.unit) {
+            case ebm::SizeUnit::BIT_FIXED:
+                return io.size.size()->value();
+            case ebm::SizeUnit::BYTE_FIXED:
+                return io.size.size()->value() * 8;
+            case ebm::SizeUnit::ELEMENT_FIXED: {
+                MAYBE(typ, tctx.type_repository().get(io.data_type));
+                if (typ.body.kind != ebm::TypeKind::ARRAY) {
+                    return std::nullopt;
+                }
+                MAYBE(elem, get_fixed_bit_size(tctx, *typ.body.element_type()));
+                if (!elem) {
+                    return std::nullopt;
+                }
+                return *elem * io.size.size()->value();
+            }
+            default:
+                return std::nullopt;
+        }
+    }
+
     expected<void> vectorized_io(TransformContext& tctx, bool write) {
         // Implementation of the grouping I/O transformation
         auto& all_statements = tctx.statement_repository().get_all();
@@ -26,13 +93,19 @@ namespace ebmgen {
             if (!block) {
                 continue;
             }
-            std::vector<std::tuple<size_t /*index in block*/, ebm::StatementRef, ebm::IOData*>> io;
-            std::vector<std::vector<std::tuple<size_t, ebm::StatementRef, ebm::IOData*>>> ios;
+            std::vector<std::tuple<size_t /*index in block*/, ebm::StatementRef, ebm::IOData*, std::uint64_t /*bit size*/>> io;
+            std::vector<std::vector<std::tuple<size_t, ebm::StatementRef, ebm::IOData*, std::uint64_t>>> ios;
             for (size_t j = 0; j < block->container.size(); j++) {
                 auto id = block->container[j];
                 MAYBE(stmt, tctx.statement_repository().get(id));
-                if (auto n = (write ? stmt.body.write_data() : stmt.body.read_data()); n && (n->size.unit == ebm::SizeUnit::BIT_FIXED || n->size.unit == ebm::SizeUnit::BYTE_FIXED)) {
-                    io.push_back({j, id, n});
+                std::optional<std::uint64_t> bit_size;
+                auto n = (write ? stmt.body.write_data() : stmt.body.read_data());
+                if (n) {
+                    MAYBE(size, get_fixed_io_bit_size(tctx, *n));
+                    bit_size = size;
+                }
+                if (bit_size) {
+                    io.push_back({j, id, n, *bit_size});
                 }
                 else {
                     if (io.size() > 1) {
@@ -53,23 +126,16 @@ namespace ebmgen {
                     for (auto& ref : g) {
                         print_if_verbose("    - Statement ID: ", get_id(std::get<1>(ref)), "\n");
                         print_if_verbose("    - Size: ", std::get<2>(ref)->size.size()->value(), " ", to_string(std::get<2>(ref)->size.unit), "\n");
+                        const auto bits = std::get<3>(ref);
                         if (all_in_byte) {
-                            if (std::get<2>(ref)->size.unit == ebm::SizeUnit::BYTE_FIXED) {
-                                all_in_byte = all_in_byte.value() + std::get<2>(ref)->size.size()->value();
+                            if (bits % 8 == 0) {
+                                all_in_byte = all_in_byte.value() + bits / 8;
                             }
                             else {
                                 all_in_byte = std::nullopt;  // Mixed units, cannot use byte
                             }
                         }
-                        if (std::get<2>(ref)->size.unit == ebm::SizeUnit::BIT_FIXED) {
-                            all_in_bits += std::get<2>(ref)->size.size()->value();
-                        }
-                        else if (std::get<2>(ref)->size.unit == ebm::SizeUnit::BYTE_FIXED) {
-                            all_in_bits += std::get<2>(ref)->size.size()->value() * 8;
-                        }
-                        else {
-                            return unexpect_error("Unsupported size unit in read I/O: {}", to_string(std::get<2>(ref)->size.unit));
-                        }
+                        all_in_bits += bits;
                     }
                     ebm::Size total_size;
                     ebm::TypeRef data_typ;
@@ -0,0 +1,330 @@
+/*license*/
+#include "transform.hpp"
+#include "pure_expression.hpp"
+#include "../convert/helper.hpp"
+#include <algorithm>
+
+namespace ebmgen {
+
+    // expression worth hoisting out of loop
+    // in addition to candidates of CSE, field load and dynamic endian check are also hoisted
+    // because they are re-evaluated on every iteration
+    // evaluated_on_entry is true if expression is evaluated whenever loop is entered (see entry_statements);
+    // otherwise hoisted expression is evaluated even when it was not originally evaluated,
+    // so it must not trap (e.g. element size or ARRAY_SIZE of self fields in loop body)
+    expected<bool> is_loop_invariant_candidate(TransformContext& tctx, ebm::ExpressionRef ref, bool evaluated_on_entry) {
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        switch (expr.body.kind) {
+            case ebm::ExpressionKind::IS_LITTLE_ENDIAN: {
+                if (is_nil(*expr.body.endian_expr())) {
+                    return false;  // platform endian is constant
+                }
+                break;
+            }
+            case ebm::ExpressionKind::MEMBER_ACCESS:
+            case ebm::ExpressionKind::ARRAY_SIZE:
+                break;
+            case ebm::ExpressionKind::TYPE_CAST: {
+                MAYBE(source, tctx.expression_repository().get(expr.body.type_cast_desc()->source_expr));
+                if (source.body.kind == ebm::ExpressionKind::IDENTIFIER ||
+                    source.body.kind == ebm::ExpressionKind::LITERAL_INT ||
+                    source.body.kind == ebm::ExpressionKind::LITERAL_INT64) {
+                    return false;
+                }
+                break;
+            }
+            case ebm::ExpressionKind::BINARY_OP: {
+                switch (*expr.body.bop()) {
+                    case ebm::BinaryOp::mul:
+                    case ebm::BinaryOp::div:
+                    case ebm::BinaryOp::mod:
+                    case ebm::BinaryOp::left_shift:
+                    case ebm::BinaryOp::right_shift:
+                    case ebm::BinaryOp::bit_and:
+                    case ebm::BinaryOp::add:
+                    case ebm::BinaryOp::sub:
+                    case ebm::BinaryOp::bit_or:
+                    case ebm::BinaryOp::bit_xor:
+                        break;
+                    default:
+                        return false;
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+        return is_pure_expression(tctx, ref, !evaluated_on_entry);
+    }
+
+    // child statement -> statement holding it (including lowered statements; weak references are not holders)
+    std::unordered_map<std::uint64_t, ebm::StatementRef> map_statement_holders(TransformContext& tctx) {
+        std::unordered_map<std::uint64_t, ebm::StatementRef> holders;
+        for (auto& stmt : tctx.statement_repository().get_all()) {
+            stmt.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+                using T = std::decay_t<decltype(val)>;
+                if constexpr (std::is_same_v<T, ebm::StatementRef>) {
+                    if (!is_nil(val)) {
+                        holders[get_id(val)] = stmt.id;
+                    }
+                }
+                else if constexpr (std::is_same_v<T, ebm::LoweredStatementRef>) {
+                    // next_lowered_loop refers loop placed in lowered_statement again
+                    if (!is_nil(val.id) && std::string_view(name) != "next_lowered_loop") {
+                        holders[get_id(val.id)] = stmt.id;
+                    }
+                }
+                else if constexpr (std::is_same_v<T, ebm::WeakStatementRef>) {
+                    // e.g. loop referred from break/continue
+                }
+                else
+                    VISITOR_RECURSE_CONTAINER(visitor, name, val)
+                else VISITOR_RECURSE(visitor, name, val)
+            });
+        }
+        return holders;
+    }
+
+    struct LoopInvariantContext {
+        TransformContext& tctx;
+        std::unordered_map<std::uint64_t, size_t>& ref_counts;
+        std::unordered_map<std::uint64_t, ebm::StatementRef>& holders;
+
+        expected<void> update_contained(std::unordered_set<std::uint64_t>& set, ebm::StatementRef ref) {
+            MAYBE(stmt, tctx.statement_repository().get(ref));
+            std::vector<ebm::ExpressionRef> slots;
+            for (auto slot : value_slots(stmt.body, true)) {
+                slots.push_back(*slot);
+            }
+            set.clear();
+            for (auto& slot : slots) {
+                MAYBE_VOID(ok, collect_eager_subexpressions(tctx, slot, set));
+            }
+            return {};
+        }
+
+        expected<void> replace_in_statement(ebm::StatementRef ref, ebm::ExpressionRef from, ebm::ExpressionRef to) {
+            MAYBE(stmt, tctx.statement_repository().get(ref));
+            std::vector<ebm::ExpressionRef> slots;
+            for (auto slot : value_slots(stmt.body, true)) {
+                slots.push_back(*slot);
+            }
+            for (auto& slot : slots) {
+                MAYBE(replaced, replace_expression(tctx, slot, from, to));
+                slot = replaced;
+            }
+            MAYBE(stmt_ptr, tctx.statement_repository().get(ref));  // refetch because memory may be relocated
+            auto new_slots = value_slots(stmt_ptr.body, true);
+            for (size_t i = 0; i < new_slots.size(); i++) {
+                *new_slots[i] = slots[i];
+            }
+            return {};
+        }
+
+        // place definitions of hoisted values just before loop
+        expected<void> insert_before(ebm::StatementRef loop, ebm::Block&& defs) {
+            auto& ctx = tctx.context();
+            auto holder = holders.at(get_id(loop));
+            MAYBE(holder_stmt, tctx.statement_repository().get(holder));
+            if (auto block = holder_stmt.body.block()) {
+                auto it = std::find(block->container.begin(), block->container.end(), loop);
+                if (it == block->container.end()) {
+                    return unexpect_error("loop {} is not found in holder block {}", get_id(loop), get_id(holder));
+                }
+                block->container.insert(it, defs.container.begin(), defs.container.end());
+                block->len = varint(block->container.size()).value();
+                return {};
+            }
+            // holder is not a block (e.g. lowered statement of io or branch of if)
+            // so wrap loop with new block
+            append(defs, loop);
+            EBM_BLOCK(wrapped, std::move(defs));
+            MAYBE(holder_ptr, tctx.statement_repository().get(holder));  // refetch because memory may be relocated
+            holder_ptr.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+                using T = std::decay_t<decltype(val)>;
+                if constexpr (std::is_same_v<T, ebm::StatementRef>) {
+                    if (val == loop) {
+                        val = wrapped;
+                    }
+                }
+                else if constexpr (std::is_same_v<T, ebm::LoweredStatementRef>) {
+                    if (val.id == loop) {
+                        val.id = wrapped;
+                    }
+                }
+                else if constexpr (std::is_same_v<T, ebm::WeakStatementRef>) {
+                    // break/continue still refer loop itself
+                }
+                else
+                    VISITOR_RECURSE_CONTAINER(visitor, name, val)
+                else VISITOR_RECURSE(visitor, name, val)
+            });
+            holders[get_id(loop)] = wrapped;
+            holders[get_id(wrapped)] = holder;
+            ref_counts[get_id(wrapped)] = 1;
+            return {};
+        }
+
+        // statements whose value slots are evaluated whenever loop is entered:
+        // loop itself (condition is evaluated at least once) and, for infinite loop,
+        // leading statements of body up to first one that may branch or exit
+        // statements of while/for body are not included because loop may run zero times
+        // for-each loop lowered to counter loop is entered with it, so entry of lowered loop is included
+        expected<std::unordered_set<std::uint64_t>> entry_statements(ebm::StatementRef loop) {
+            std::unordered_set<std::uint64_t> entry{get_id(loop)};
+            MAYBE(loop_stmt, tctx.statement_repository().get(loop));
+            MAYBE(loop_body, loop_stmt.body.loop());
+            if (auto lowered = loop_body.lowered_statement.id; !is_nil(lowered)) {
+                MAYBE(lowered_stmt, tctx.statement_repository().get(lowered));
+                if (lowered_stmt.body.kind == ebm::StatementKind::LOOP_STATEMENT) {
+                    MAYBE(lowered_entry, entry_statements(lowered));
+                    entry.insert(lowered_entry.begin(), lowered_entry.end());
+                }
+                return entry;
+            }
+            if (loop_body.loop_type != ebm::LoopType::INFINITE) {
+                return entry;
+            }
+            const auto body = loop_body.body;
+            MAYBE(body_stmt, tctx.statement_repository().get(body));
+            auto block = body_stmt.body.block();
+            if (!block) {
+                entry.insert(get_id(body));
+                return entry;
+            }
+            for (auto& child : block->container) {
+                entry.insert(get_id(child));
+                MAYBE(child_stmt, tctx.statement_repository().get(child));
+                if (child_stmt.body.kind != ebm::StatementKind::VARIABLE_DECL &&
+                    child_stmt.body.kind != ebm::StatementKind::ASSIGNMENT) {
+                    break;
+                }
+            }
+            return entry;
+        }
+
+        // T = expr
+        // loop:
+        //    ... T ...
+        expected<size_t> hoist(ebm::StatementRef loop) {
+            auto holder = holders.find(get_id(loop));
+            if (holder == holders.end()) {
+                return 0;  // held by expression or unreachable
+            }
+            MAYBE(holder_stmt, tctx.statement_repository().get(holder->second));
+            if (holder_stmt.body.kind == ebm::StatementKind::LOOP_STATEMENT) {
+                return 0;  // lowered form of other loop; backends expect loop there
+            }
+            MAYBE(nested, collect_nested_statements(tctx, loop, true));
+            std::unordered_set<std::uint64_t> written;
+            for (auto& ref : nested.order) {
+                MAYBE(effect, get_statement_effect(tctx, ref));
+                if (effect.unknown) {
+                    return 0;
+                }
+                written.insert(effect.written.begin(), effect.written.end());
+            }
+            std::unordered_map<std::uint64_t, std::unordered_set<std::uint64_t>> contained;
+            std::vector<ebm::StatementRef> targets;
+            for (auto& ref : nested.order) {
+                // shared statements may be placed out of this loop, so cannot be rewritten in place
+                if (ref_counts[get_id(ref)] != 1) {
+                    continue;
+                }
+                MAYBE_VOID(ok, update_contained(contained[get_id(ref)], ref));
+                if (contained[get_id(ref)].size()) {
+                    targets.push_back(ref);
+                }
+            }
+            MAYBE(entry, entry_statements(loop));
+            // statements evaluated on entry first so that expression appearing in both is checked as evaluated on entry
+            std::stable_partition(targets.begin(), targets.end(), [&](auto& ref) { return entry.contains(get_id(ref)); });
+            std::unordered_set<std::uint64_t> checked;
+            std::vector<std::pair<size_t, ebm::ExpressionRef>> candidates;
+            for (auto& ref : targets) {
+                const bool evaluated_on_entry = entry.contains(get_id(ref));
+                for (auto& e : contained[get_id(ref)]) {
+                    if (!checked.insert(e).second) {
+                        continue;
+                    }
+                    MAYBE(id, varint(e));
+                    ebm::ExpressionRef expr_ref{id};
+                    MAYBE(ok, is_loop_invariant_candidate(tctx, expr_ref, evaluated_on_entry));
+                    if (!ok) {
+                        continue;
+                    }
+                    std::unordered_set<std::uint64_t> ids;
+                    MAYBE_VOID(collected, collect_identifiers(tctx, expr_ref, ids));
+                    if (ids.empty() || std::any_of(ids.begin(), ids.end(), [&](auto id) { return written.contains(id); })) {
+                        continue;
+                    }
+                    candidates.emplace_back(expression_size(tctx, expr_ref), expr_ref);
+                }
+            }
+            // larger expression first so that its sub expressions are hoisted at once
+            std::sort(candidates.begin(), candidates.end(), [](auto& a, auto& b) {
+                return a.first != b.first ? a.first > b.first : a.second < b.second;
+            });
+            auto& ctx = tctx.context();
+            ebm::Block defs;
+            for (auto& [_, expr_ref] : candidates) {
+                std::vector<ebm::StatementRef> users;
+                for (auto& ref : targets) {
+                    // may be already replaced by larger expression
+                    if (contained[get_id(ref)].contains(get_id(expr_ref))) {
+                        users.push_back(ref);
+                    }
+                }
+                if (users.empty()) {
+                    continue;
+                }
+                MAYBE(expr, tctx.expression_repository().get(expr_ref));
+                const auto typ = expr.body.type;
+                EBM_DEFINE_VARIABLE(tmp, {}, typ, expr_ref, ebm::VariableDeclKind::IMMUTABLE, false);
+                for (auto& ref : users) {
+                    MAYBE_VOID(replaced, replace_in_statement(ref, expr_ref, tmp));
+                    MAYBE_VOID(updated, update_contained(contained[get_id(ref)], ref));
+                }
+                append(defs, tmp_def);
+            }
+            const auto hoisted = defs.container.size();
+            if (hoisted) {
+                MAYBE_VOID(inserted, insert_before(loop, std::move(defs)));
+            }
+            return hoisted;
+        }
+    };
+
+    expected<void> loop_invariant_code_motion(TransformContext& tctx) {
+        auto ref_counts = count_statement_references(tctx);
+        // next_lowered_loop is not another placement of the loop (see map_statement_holders)
+        for (auto& stmt : tctx.statement_repository().get_all()) {
+            if (auto loop = stmt.body.loop(); loop && !is_nil(loop->next_lowered_loop.id)) {
+                ref_counts[get_id(loop->next_lowered_loop.id)]--;
+            }
+        }
+        auto holders = map_statement_holders(tctx);
+        std::vector<ebm::StatementRef> loops;
+        for (auto& stmt : tctx.statement_repository().get_all()) {
+            if (stmt.body.kind == ebm::StatementKind::LOOP_STATEMENT && ref_counts[get_id(stmt.id)] == 1) {
+                loops.push_back(stmt.id);
+            }
+        }
+        // statements are added after their children, so that reverse order visits outer loop first
+        // and invariant expressions are hoisted as far as possible at once
+        std::reverse(loops.begin(), loops.end());
+        LoopInvariantContext licm{
+            .tctx = tctx,
+            .ref_counts = ref_counts,
+            .holders = holders,
+        };
+        size_t hoisted = 0;
+        for (auto& loop : loops) {
+            MAYBE(count, licm.hoist(loop));
+            hoisted += count;
+        }
+        print_if_verbose("Loop invariant expressions hoisted: ", hoisted, "\n");
+        return {};
+    }
+
+}  // namespace ebmgen
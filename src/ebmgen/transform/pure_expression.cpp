@@ -0,0 +1,537 @@
+/*license*/
+#include "pure_expression.hpp"
+#include "../common.hpp"
+#include "../convert/helper.hpp"
+#include "ebm/extended_binary_module.hpp"
+
+namespace ebmgen {
+
+    expected<FunctionStatements> collect_nested_statements(TransformContext& tctx, ebm::StatementRef root, bool include_lowered) {
+        FunctionStatements result;
+        std::unordered_set<std::uint64_t> visited;
+        auto walk = [&](auto&& walk, ebm::StatementRef ref, ebm::StatementRef parent) -> expected<void> {
+            if (is_nil(ref) || !visited.insert(get_id(ref)).second) {
+                return {};
+            }
+            if (!is_nil(parent)) {
+                result.parent[get_id(ref)] = parent;
+            }
+            result.order.push_back(ref);
+            MAYBE(stmt, tctx.statement_repository().get(ref));
+            std::vector<ebm::StatementRef> children;
+            if (auto block = stmt.body.block()) {
+                children.assign(block->container.begin(), block->container.end());
+            }
+            else if (auto if_ = stmt.body.if_statement()) {
+                children = {if_->then_block, if_->else_block};
+            }
+            else if (auto loop = stmt.body.loop()) {
+                children = {loop->body};
+                if (auto init = loop->init()) {
+                    children.push_back(*init);
+                }
+                if (auto increment = loop->increment()) {
+                    children.push_back(*increment);
+                }
+            }
+            else if (auto match = stmt.body.match_statement()) {
+                children.assign(match->branches.container.begin(), match->branches.container.end());
+            }
+            else if (auto branch = stmt.body.match_branch()) {
+                children = {branch->body};
+            }
+            else if (auto sub_range = stmt.body.sub_byte_range()) {
+                children = {sub_range->io_statement};
+            }
+            if (include_lowered) {
+                stmt.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::LoweredStatementRef>) {
+                        children.push_back(val.id);
+                    }
+                    else
+                        VISITOR_RECURSE_CONTAINER(visitor, name, val)
+                    else VISITOR_RECURSE(visitor, name, val)
+                });
+            }
+            // stmt may be relocated after recursion, but children are already copied
+            for (auto& child : children) {
+                MAYBE_VOID(ok, walk(walk, child, ref));
+            }
+            return {};
+        };
+        MAYBE_VOID(ok, walk(walk, root, ebm::StatementRef{}));
+        return result;
+    }
+
+    expected<FunctionStatements> collect_function_statements(TransformContext& tctx, ebm::StatementRef body) {
+        return collect_nested_statements(tctx, body, false);
+    }
+
+    std::unordered_map<std::uint64_t, size_t> count_statement_references(TransformContext& tctx) {
+        std::unordered_map<std::uint64_t, size_t> counts;
+        auto count = [&](auto& item) {
+            item.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+                if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::StatementRef>) {
+                    if (!is_nil(val)) {
+                        counts[get_id(val)]++;
+                    }
+                }
+                else
+                    VISITOR_RECURSE_CONTAINER(visitor, name, val)
+                else VISITOR_RECURSE(visitor, name, val)
+            });
+        };
+        for (auto& stmt : tctx.statement_repository().get_all()) {
+            count(stmt);
+        }
+        for (auto& expr : tctx.expression_repository().get_all()) {
+            count(expr);
+        }
+        return counts;
+    }
+
+    expected<bool> has_side_effect(TransformContext& tctx, ebm::ExpressionRef ref) {
+        if (is_nil(ref)) {
+            return false;
+        }
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        switch (expr.body.kind) {
+            case ebm::ExpressionKind::CALL:
+            case ebm::ExpressionKind::READ_DATA:
+            case ebm::ExpressionKind::WRITE_DATA:
+            case ebm::ExpressionKind::CONDITIONAL_STATEMENT:
+            case ebm::ExpressionKind::SUB_RANGE_INIT:
+            case ebm::ExpressionKind::SETTER_STATUS:
+                return true;
+            default:
+                break;
+        }
+        std::vector<ebm::ExpressionRef> children;
+        expr.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+            if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::ExpressionRef>) {
+                children.push_back(val);
+            }
+            else
+                VISITOR_RECURSE_CONTAINER(visitor, name, val)
+            else VISITOR_RECURSE(visitor, name, val)
+        });
+        for (auto& child : children) {
+            MAYBE(effect, has_side_effect(tctx, child));
+            if (effect) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    expected<bool> is_scalar_type(TransformContext& tctx, ebm::TypeRef ref) {
+        MAYBE(typ, tctx.type_repository().get(ref));
+        switch (typ.body.kind) {
+            case ebm::TypeKind::INT:
+            case ebm::TypeKind::UINT:
+            case ebm::TypeKind::USIZE:
+            case ebm::TypeKind::FLOAT:
+            case ebm::TypeKind::BOOL:
+            case ebm::TypeKind::ENUM:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    expected<bool> is_pure_operand(TransformContext& tctx, ebm::ExpressionRef ref, bool speculative) {
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        switch (expr.body.kind) {
+            case ebm::ExpressionKind::LITERAL_INT:
+            case ebm::ExpressionKind::LITERAL_INT64:
+            case ebm::ExpressionKind::LITERAL_BOOL:
+            case ebm::ExpressionKind::LITERAL_CHAR:
+            case ebm::ExpressionKind::ENUM_MEMBER:
+            case ebm::ExpressionKind::MAX_VALUE:
+            case ebm::ExpressionKind::SELF:
+            case ebm::ExpressionKind::IS_LITTLE_ENDIAN:
+                return true;
+            case ebm::ExpressionKind::IDENTIFIER: {
+                MAYBE(def, tctx.statement_repository().get(from_weak(*expr.body.id())));
+                if (auto var = def.body.var_decl()) {
+                    return !var->is_reference();
+                }
+                return def.body.kind == ebm::StatementKind::FIELD_DECL ||
+                       def.body.kind == ebm::StatementKind::PARAMETER_DECL ||
+                       def.body.kind == ebm::StatementKind::ENUM_MEMBER_DECL;
+            }
+            case ebm::ExpressionKind::MEMBER_ACCESS: {
+                // member must be plain field (property may be computed by getter)
+                MAYBE(member, is_pure_operand(tctx, *expr.body.member(), speculative));
+                if (!member) {
+                    return false;
+                }
+                if (speculative) {
+                    // access through pointer, optional or variant may trap
+                    MAYBE(base, tctx.expression_repository().get(*expr.body.base()));
+                    MAYBE(base_type, tctx.type_repository().get(base.body.type));
+                    if (base_type.body.kind != ebm::TypeKind::STRUCT) {
+                        return false;
+                    }
+                }
+                return is_pure_operand(tctx, *expr.body.base(), speculative);
+            }
+            case ebm::ExpressionKind::ARRAY_SIZE: {
+                return is_pure_operand(tctx, *expr.body.array_expr(), speculative);
+            }
+            case ebm::ExpressionKind::UNARY_OP: {
+                return is_pure_operand(tctx, *expr.body.operand(), speculative);
+            }
+            case ebm::ExpressionKind::TYPE_CAST: {
+                auto desc = expr.body.type_cast_desc();
+                if (desc->cast_kind == ebm::CastType::FUNCTION_CAST) {
+                    return false;
+                }
+                return is_pure_operand(tctx, desc->source_expr, speculative);
+            }
+            case ebm::ExpressionKind::BINARY_OP: {
+                const auto bop = *expr.body.bop();
+                const auto left = *expr.body.left();
+                const auto right = *expr.body.right();
+                if (speculative) {
+                    switch (bop) {
+                        case ebm::BinaryOp::div:
+                        case ebm::BinaryOp::mod: {
+                            MAYBE(divisor, tctx.expression_repository().get(right));
+                            auto value = divisor.body.int_value();
+                            if (!value || value->value() == 0) {
+                                return false;
+                            }
+                            break;
+                        }
+                        // overflow is checked by some backends (e.g. rust debug build)
+                        case ebm::BinaryOp::add:
+                        case ebm::BinaryOp::sub:
+                        case ebm::BinaryOp::mul:
+                        case ebm::BinaryOp::left_shift:
+                        case ebm::BinaryOp::right_shift:
+                            return false;
+                        default:
+                            break;
+                    }
+                }
+                MAYBE(l, is_pure_operand(tctx, left, speculative));
+                if (!l) {
+                    return false;
+                }
+                return is_pure_operand(tctx, right, speculative);
+            }
+            default:
+                return false;
+        }
+    }
+
+    expected<bool> is_pure_expression(TransformContext& tctx, ebm::ExpressionRef ref, bool speculative) {
+        if (is_nil(ref)) {
+            return false;
+        }
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        MAYBE(scalar, is_scalar_type(tctx, expr.body.type));
+        if (!scalar) {
+            return false;
+        }
+        return is_pure_operand(tctx, ref, speculative);
+    }
+
+    expected<void> collect_identifiers(TransformContext& tctx, ebm::ExpressionRef ref, std::unordered_set<std::uint64_t>& ids) {
+        if (is_nil(ref)) {
+            return {};
+        }
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        if (auto id = expr.body.id()) {
+            ids.insert(get_id(*id));
+        }
+        if (auto endian = expr.body.endian_expr(); endian && !is_nil(*endian)) {
+            ids.insert(get_id(*endian));
+        }
+        std::vector<ebm::ExpressionRef> children;
+        expr.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+            if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::ExpressionRef>) {
+                children.push_back(val);
+            }
+            else
+                VISITOR_RECURSE_CONTAINER(visitor, name, val)
+            else VISITOR_RECURSE(visitor, name, val)
+        });
+        for (auto& child : children) {
+            MAYBE_VOID(ok, collect_identifiers(tctx, child, ids));
+        }
+        return {};
+    }
+
+    // effect of writing to target
+    // writing through reference or parameter may alias anything, so it is treated as unknown
+    expected<void> add_write_target(TransformContext& tctx, ebm::ExpressionRef target, StatementEffect& effect) {
+        if (is_nil(target)) {
+            return {};
+        }
+        auto root = target;
+        while (true) {
+            MAYBE(expr, tctx.expression_repository().get(root));
+            if (auto base = expr.body.base()) {
+                root = *base;
+                continue;
+            }
+            if (auto id = expr.body.id()) {
+                MAYBE(def, tctx.statement_repository().get(from_weak(*id)));
+                auto var = def.body.var_decl();
+                if ((var && var->is_reference()) || def.body.kind == ebm::StatementKind::PARAMETER_DECL) {
+                    effect.unknown = true;
+                }
+            }
+            else if (expr.body.kind != ebm::ExpressionKind::SELF || root == target) {
+                effect.unknown = true;  // writing whole self has no identifier to record
+            }
+            break;
+        }
+        return collect_identifiers(tctx, target, effect.written);
+    }
+
+    expected<StatementEffect> get_statement_effect(TransformContext& tctx, ebm::StatementRef ref) {
+        StatementEffect effect;
+        if (is_nil(ref)) {
+            return effect;
+        }
+        MAYBE(stmt, tctx.statement_repository().get(ref));
+        const auto body = stmt.body;  // copy because repository may be accessed recursively
+        std::vector<ebm::ExpressionRef> exprs;
+        body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+            if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::ExpressionRef>) {
+                exprs.push_back(val);
+            }
+            else
+                VISITOR_RECURSE_CONTAINER(visitor, name, val)
+            else VISITOR_RECURSE(visitor, name, val)
+        });
+        for (auto& e : exprs) {
+            MAYBE(side_effect, has_side_effect(tctx, e));
+            if (side_effect) {
+                effect.unknown = true;
+                return effect;
+            }
+        }
+        switch (body.kind) {
+            case ebm::StatementKind::BLOCK:
+            case ebm::StatementKind::IF_STATEMENT:
+            case ebm::StatementKind::MATCH_STATEMENT:
+            case ebm::StatementKind::MATCH_BRANCH:
+            case ebm::StatementKind::ASSERT:
+            case ebm::StatementKind::BREAK:
+            case ebm::StatementKind::CONTINUE:
+            case ebm::StatementKind::RETURN:
+            case ebm::StatementKind::ERROR_RETURN:
+            case ebm::StatementKind::ERROR_REPORT:
+            case ebm::StatementKind::WRITE_DATA:
+            case ebm::StatementKind::RESERVE_DATA:
+            case ebm::StatementKind::LENGTH_CHECK:
+            case ebm::StatementKind::METADATA:
+            case ebm::StatementKind::INIT_CHECK:
+            case ebm::StatementKind::LOWERED_IO_STATEMENTS:
+                break;
+            case ebm::StatementKind::VARIABLE_DECL:
+            case ebm::StatementKind::ENDIAN_VARIABLE:
+                effect.written.insert(get_id(ref));
+                break;
+            case ebm::StatementKind::ASSIGNMENT:
+            case ebm::StatementKind::YIELD:
+            case ebm::StatementKind::APPEND: {
+                MAYBE_VOID(ok, add_write_target(tctx, *body.target(), effect));
+                break;
+            }
+            case ebm::StatementKind::READ_DATA: {
+                MAYBE_VOID(ok, add_write_target(tctx, body.read_data()->target, effect));
+                break;
+            }
+            case ebm::StatementKind::ARRAY_TO_INT:
+            case ebm::StatementKind::INT_TO_ARRAY: {
+                MAYBE_VOID(ok, add_write_target(tctx, body.endian_convert()->target, effect));
+                break;
+            }
+            case ebm::StatementKind::LOOP_STATEMENT: {
+                auto loop = body.loop();
+                // loop header of for/for-each loop updates its counter on each iteration
+                if (auto item = loop->item_var()) {
+                    effect.written.insert(get_id(*item));
+                }
+                for (auto sub : {loop->init(), loop->increment()}) {
+                    if (!sub) {
+                        continue;
+                    }
+                    MAYBE(sub_effect, get_statement_effect(tctx, *sub));
+                    effect.unknown = effect.unknown || sub_effect.unknown;
+                    effect.written.insert(sub_effect.written.begin(), sub_effect.written.end());
+                }
+                break;
+            }
+            default:
+                effect.unknown = true;
+                break;
+        }
+        return effect;
+    }
+
+    std::vector<ebm::ExpressionRef*> value_slots(ebm::StatementBody& body, bool include_loop_condition) {
+        std::vector<ebm::ExpressionRef*> slots;
+        switch (body.kind) {
+            case ebm::StatementKind::LOOP_STATEMENT:
+                if (auto cond = body.loop()->condition(); cond && include_loop_condition) {
+                    slots.push_back(&cond->cond);
+                }
+                break;
+            case ebm::StatementKind::VARIABLE_DECL:
+                slots.push_back(&body.var_decl()->initial_value);
+                break;
+            case ebm::StatementKind::ASSIGNMENT:
+            case ebm::StatementKind::YIELD:
+            case ebm::StatementKind::APPEND:
+            case ebm::StatementKind::RETURN:
+                slots.push_back(body.value());
+                break;
+            case ebm::StatementKind::IF_STATEMENT:
+                slots.push_back(&body.if_statement()->condition.cond);
+                break;
+            case ebm::StatementKind::ASSERT:
+                slots.push_back(&body.assert_desc()->condition.cond);
+                break;
+            case ebm::StatementKind::MATCH_STATEMENT:
+                slots.push_back(&body.match_statement()->target);
+                break;
+            case ebm::StatementKind::READ_DATA:
+            case ebm::StatementKind::WRITE_DATA: {
+                auto io = body.read_data() ? body.read_data() : body.write_data();
+                if (auto size_ref = io->size.ref()) {
+                    slots.push_back(size_ref);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        std::erase_if(slots, [](auto* slot) { return !slot || is_nil(*slot); });
+        return slots;
+    }
+
+    expected<void> collect_eager_subexpressions(TransformContext& tctx, ebm::ExpressionRef ref, std::unordered_set<std::uint64_t>& exprs) {
+        if (is_nil(ref)) {
+            return {};
+        }
+        exprs.insert(get_id(ref));
+        MAYBE(expr, tctx.expression_repository().get(ref));
+        std::vector<ebm::ExpressionRef> children;
+        switch (expr.body.kind) {
+            case ebm::ExpressionKind::BINARY_OP: {
+                children.push_back(*expr.body.left());
+                auto bop = *expr.body.bop();
+                if (bop != ebm::BinaryOp::logical_and && bop != ebm::BinaryOp::logical_or) {
+                    children.push_back(*expr.body.right());
+                }
+                break;
+            }
+            case ebm::ExpressionKind::CONDITIONAL:
+                children.push_back(*expr.body.condition());
+                break;
+            case ebm::ExpressionKind::READ_DATA:
+            case ebm::ExpressionKind::WRITE_DATA:
+            case ebm::ExpressionKind::CONDITIONAL_STATEMENT:
+            case ebm::ExpressionKind::AVAILABLE:
+            case ebm::ExpressionKind::MAX_VALUE:
+            // operand is used as place, not as value
+            // (common subexpression elimination must not hold it in temporary,
+            // e.g. as_arg(&self.x) would pass address of copy)
+            case ebm::ExpressionKind::ADDRESS_OF:
+            case ebm::ExpressionKind::OPTIONAL_OF:
+            case ebm::ExpressionKind::AS_ARG:
+                break;
+            default:
+                expr.body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+                    using T = std::decay_t<decltype(val)>;
+                    if constexpr (std::is_same_v<T, ebm::ExpressionRef>) {
+                        children.push_back(val);
+                    }
+                    else if constexpr (std::is_same_v<T, ebm::LoweredExpressionRef>) {
+                        // ignore
+                    }
+                    else
+                        VISITOR_RECURSE_CONTAINER(visitor, name, val)
+                    else VISITOR_RECURSE(visitor, name, val)
+                });
+                break;
+        }
+        for (auto& child : children) {
+            MAYBE_VOID(ok, collect_eager_subexpressions(tctx, child, exprs));
+        }
+        return {};
+    }
+
+    expected<ebm::ExpressionRef> replace_expression(TransformContext& tctx, ebm::ExpressionRef root, ebm::ExpressionRef from, ebm::ExpressionRef to) {
+        if (is_nil(root)) {
+            return root;
+        }
+        if (root == from) {
+            return to;
+        }
+        MAYBE(expr, tctx.expression_repository().get(root));
+        switch (expr.body.kind) {
+            case ebm::ExpressionKind::ADDRESS_OF:
+            case ebm::ExpressionKind::OPTIONAL_OF:
+            case ebm::ExpressionKind::AS_ARG:
+                return root;  // replacing place with value changes meaning
+            default:
+                break;
+        }
+        auto body = expr.body;  // copy on write; expression may be shared by hash-consing
+        std::vector<ebm::ExpressionRef*> children;
+        body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+            if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::ExpressionRef>) {
+                children.push_back(&val);
+            }
+            else
+                VISITOR_RECURSE_CONTAINER(visitor, name, val)
+            else VISITOR_RECURSE(visitor, name, val)
+        });
+        bool changed = false;
+        for (auto child : children) {
+            MAYBE(replaced, replace_expression(tctx, *child, from, to));
+            if (replaced != *child) {
+                *child = replaced;
+                changed = true;
+            }
+        }
+        if (!changed) {
+            return root;
+        }
+        auto& ctx = tctx.context();
+        EBMA_ADD_EXPR(new_ref, std::move(body));
+        return new_ref;
+    }
+
+    size_t expression_size(TransformContext& tctx, ebm::ExpressionRef ref) {
+        if (is_nil(ref)) {
+            return 0;
+        }
+        auto expr = tctx.expression_repository().get(ref);
+        if (!expr) {
+            return 0;
+        }
+        size_t size = 1;
+        std::vector<ebm::ExpressionRef> children;
+        expr->body.visit([&](auto&& visitor, const char* name, auto&& val) -> void {
+            if constexpr (std::is_same_v<std::decay_t<decltype(val)>, ebm::ExpressionRef>) {
+                children.push_back(val);
+            }
+            else
+                VISITOR_RECURSE_CONTAINER(visitor, name, val)
+            else VISITOR_RECURSE(visitor, name, val)
+        });
+        for (auto& child : children) {
+            size += expression_size(tctx, child);
+        }
+        return size;
+    }
+
+}  // namespace ebmgen
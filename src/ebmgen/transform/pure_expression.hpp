@@ -0,0 +1,66 @@
+/*license*/
+#pragma once
+#include "../converter.hpp"
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ebmgen {
+
+    // statements of function body reachable without going through lowered statements
+    struct FunctionStatements {
+        std::vector<ebm::StatementRef> order;                           // pre-order
+        std::unordered_map<std::uint64_t, ebm::StatementRef> parent;  // child -> parent statement
+    };
+
+    expected<FunctionStatements> collect_function_statements(TransformContext& tctx, ebm::StatementRef body);
+    // same as above but from arbitrary statement, optionally including lowered statements
+    expected<FunctionStatements> collect_nested_statements(TransformContext& tctx, ebm::StatementRef root, bool include_lowered);
+
+    // number of strong references to each statement
+    // statement referred more than once is shared by hash-consing and must not be rewritten in place
+    std::unordered_map<std::uint64_t, size_t> count_statement_references(TransformContext& tctx);
+
+    // pure expression is an expression that
+    // - has no side effect (no call, io or statement as expression)
+    // - evaluates to scalar value (so that holding it in temporary variable is cheap)
+    // - does not refer variables through reference
+    // if speculative is true, expression may be evaluated where it was not originally evaluated,
+    // so that expressions that may trap (division by non-constant, overflowing arithmetic,
+    // member access through pointer, optional or variant) are also rejected
+    expected<bool> is_pure_expression(TransformContext& tctx, ebm::ExpressionRef ref, bool speculative);
+    expected<bool> has_side_effect(TransformContext& tctx, ebm::ExpressionRef ref);
+    // identifiers (and dynamic endian variables) whose value the expression depends on
+    expected<void> collect_identifiers(TransformContext& tctx, ebm::ExpressionRef ref, std::unordered_set<std::uint64_t>& ids);
+
+    // variables possibly written by statement itself (child statements are not included)
+    struct StatementEffect {
+        bool unknown = false;  // may write anything
+        std::unordered_set<std::uint64_t> written;
+
+        bool kills(const std::unordered_set<std::uint64_t>& ids) const {
+            if (unknown) {
+                return true;
+            }
+            for (auto& id : ids) {
+                if (written.contains(id)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    expected<StatementEffect> get_statement_effect(TransformContext& tctx, ebm::StatementRef ref);
+
+    // expressions evaluated by statement itself unconditionally and before its effect
+    // (e.g. initial value of variable, assigned value, condition of if)
+    // condition of loop is evaluated on each iteration, so it is included only on request
+    std::vector<ebm::ExpressionRef*> value_slots(ebm::StatementBody& body, bool include_loop_condition = false);
+    // sub expressions of ref that are evaluated whenever ref is evaluated
+    // (operands of short circuit and conditional operators are not included)
+    expected<void> collect_eager_subexpressions(TransformContext& tctx, ebm::ExpressionRef ref, std::unordered_set<std::uint64_t>& exprs);
+    // replace `from` in `root` with `to` without modifying existing expressions
+    expected<ebm::ExpressionRef> replace_expression(TransformContext& tctx, ebm::ExpressionRef root, ebm::ExpressionRef from, ebm::ExpressionRef to);
+    size_t expression_size(TransformContext& tctx, ebm::ExpressionRef ref);
+
+}  // namespace ebmgen
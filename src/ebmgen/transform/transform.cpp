@@ -8,7 +8,7 @@
 
 namespace ebmgen {
 
-    expected<void> transform(TransformContext& ctx, bool debug, std::function<void(const char*)> timer) {
+    expected<void> transform(TransformContext& ctx, bool debug, std::function<void(const char*)> timer, OptimizationFlags opt) {
         MAYBE_VOID(flatten_io_expression, flatten_io_expression(ctx));
         if (timer) {
             timer("flatten io expression");
@@ -33,6 +33,10 @@ namespace ebmgen {
         if (timer) {
             timer("merge bit field");
         }
+        MAYBE_VOID(fixed_layout, fixed_layout_struct(ctx));
+        if (timer) {
+            timer("fixed layout struct");
+        }
         MAYBE_VOID(vio_read, vectorized_io(ctx, false));
         if (timer) {
             timer("vectorized io read");
@@ -41,6 +45,10 @@ namespace ebmgen {
         if (timer) {
             timer("vectorized io write");
         }
+        MAYBE_VOID(bulk_array, bulk_primitive_array_io(ctx));
+        if (timer) {
+            timer("bulk primitive array io");
+        }
         MAYBE_VOID(prop_setter_getter, derive_property_setter_getter(ctx));
         if (timer) {
             timer("derive property setter/getter");
@@ -53,6 +61,18 @@ namespace ebmgen {
         if (timer) {
             timer("derive array setter");
         }
+        if (opt.loop_invariant_code_motion) {
+            MAYBE_VOID(licm, loop_invariant_code_motion(ctx));
+            if (timer) {
+                timer("loop invariant code motion");
+            }
+        }
+        if (opt.common_subexpression_elimination) {
+            MAYBE_VOID(cse, common_subexpression_elimination(ctx));
+            if (timer) {
+                timer("common subexpression elimination");
+            }
+        }
         if (!debug) {
             MAYBE_VOID(remove_unused, remove_unused_object(ctx, timer));
             ctx.recalculate_id_index_map();
@@ -6,10 +6,17 @@
 
 namespace ebmgen {
 
-    expected<void> transform(TransformContext& ctx, bool debug, std::function<void(const char*)> timer);
+    // optimization passes which can be disabled from command line
+    struct OptimizationFlags {
+        bool loop_invariant_code_motion = true;
+        bool common_subexpression_elimination = true;
+    };
+
+    expected<void> transform(TransformContext& ctx, bool debug, std::function<void(const char*)> timer, OptimizationFlags opt = {});
 
     ebm::Block* get_block(ebm::StatementBody& body);
     expected<void> vectorized_io(TransformContext& tctx, bool write);
+    expected<std::optional<std::uint64_t>> get_fixed_bit_size(TransformContext& tctx, ebm::TypeRef type);
     expected<void> remove_unused_object(TransformContext& ctx, std::function<void(const char*)> timer);
     expected<void> lowered_dynamic_bit_io(CFGContext& tctx, bool write);
     expected<void> merge_bit_field(TransformContext& tctx);
@@ -17,4 +24,8 @@ namespace ebmgen {
     expected<void> flatten_io_expression(TransformContext& tctx);
     expected<void> add_cast_func(TransformContext& tctx);
     expected<void> derive_array_setter(TransformContext& tctx);
+    expected<void> fixed_layout_struct(TransformContext& tctx);
+    expected<void> bulk_primitive_array_io(TransformContext& tctx);
+    expected<void> loop_invariant_code_motion(TransformContext& tctx);
+    expected<void> common_subexpression_elimination(TransformContext& tctx);
 }  // namespace ebmgen
@@ -1,6 +0,0 @@
-/*license*/
-#pragma once
-
-namespace ebmgen {
-    
-}
\ No newline at end of file